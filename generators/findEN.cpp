@@ -18,8 +18,7 @@
 
 #include "generators/RandomStronglyConnectedGenerator.hpp"
 #include "exploration/BestFirstSearch.hpp"
-
-using namespace std::placeholders;
+#include "exploration/Heuristics.hpp"
 
 int main() {
     for (std::size_t nPlayers = 4 ; nPlayers < 50 ; nPlayers++) {
@@ -34,7 +33,7 @@ int main() {
             for (std::size_t i = 0 ; i < 10000 ; i++) {
                 ReachabilityGame game = generators::randomStronglyConnectedGenerator(size, 1, 2, 1, 1, true, nPlayers, false, probaPlayers, probaTargets, maximumTargets);
 
-                Path path = exploration::bestFirstSearch(game, std::bind(&ReachabilityGame::AStartPositive, &game, _1, _2));
+                Path path = exploration::bestFirstSearch(game, exploration::heuristics::AStarPositive(game));
 
                 bool all = true;
                 for (auto &c : path.getCosts()) {
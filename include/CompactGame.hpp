@@ -0,0 +1,277 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ReachabilityGame.hpp"
+
+/**
+ * \brief Un jeu d'atteignabilité en lecture seule stocké sous forme compacte (CSR).
+ * 
+ * Les arcs sortants du sommet v sont les arcs offsets[v], ..., offsets[v+1] - 1. Pour l'arc e, successors[e] est l'ID du successeur et weights[e * nPlayers + i] est le poids pour le joueur i.
+ * 
+ * Pour chaque sommet, owners[v] est le joueur qui le possède et les bits de targets[v * targetWords], ..., targets[(v+1) * targetWords - 1] indiquent les joueurs pour qui v est une cible.
+ * 
+ * Le jeu ne fait que regarder les tableaux : ils appartiennent à un objet de stockage partagé (des std::vector, une projection en mémoire d'un fichier, ...) qui reste vivant tant qu'une copie du jeu existe. Copier un CompactGame ne copie donc pas les tableaux.
+ */
+class CompactGame {
+public:
+    /**
+     * \brief Construit le jeu à partir de tableaux existants
+     * \param nVertices Le nombre de sommets
+     * \param nEdges Le nombre d'arcs
+     * \param nPlayers Le nombre de joueurs
+     * \param init L'ID du sommet initial
+     * \param offsets Les débuts des listes d'arcs (taille : nVertices + 1)
+     * \param successors Les successeurs (taille : nEdges)
+     * \param weights Les poids (taille : nEdges * nPlayers)
+     * \param owners Les propriétaires des sommets (taille : nVertices)
+     * \param targets Les cibles (taille : nVertices * targetWords(nPlayers))
+     * \param storage L'objet qui possède les tableaux
+     */
+    CompactGame(std::size_t nVertices, std::size_t nEdges, std::size_t nPlayers, unsigned int init, const std::size_t* offsets, const unsigned int* successors, const long* weights, const unsigned int* owners, const std::uint64_t* targets, std::shared_ptr<const void> storage);
+
+    /**
+     * \brief Donne le nombre de mots de 64 bits nécessaires pour stocker les cibles d'un sommet
+     * \param nPlayers Le nombre de joueurs
+     * \return Le nombre de mots par sommet
+     */
+    static std::size_t targetWords(std::size_t nPlayers) {
+        return (nPlayers + 63) / 64;
+    }
+
+    /**
+     * \brief Convertit un jeu d'atteignabilité
+     * \param game Le jeu
+     * \return Le jeu sous forme compacte
+     */
+    static CompactGame fromReachabilityGame(const ReachabilityGame &game);
+
+    /**
+     * \brief Construit un ReachabilityGame équivalent.
+     * 
+     * Utile pour utiliser les algorithmes qui ne travaillent que sur ReachabilityGame.
+     * \return Le jeu
+     */
+    ReachabilityGame toReachabilityGame() const;
+
+    /**
+     * \brief Donne le nombre de sommets
+     */
+    std::size_t size() const {
+        return m_nVertices;
+    }
+
+    /**
+     * \brief Donne le nombre d'arcs
+     */
+    std::size_t getNumberEdges() const {
+        return m_nEdges;
+    }
+
+    /**
+     * \brief Donne le nombre de joueurs
+     */
+    std::size_t getNumberPlayers() const {
+        return m_nPlayers;
+    }
+
+    /**
+     * \brief Donne l'ID du sommet initial
+     */
+    unsigned int getInit() const {
+        return m_init;
+    }
+
+    /**
+     * \brief Donne le premier arc sortant de v
+     */
+    std::size_t beginEdges(unsigned int v) const {
+        return m_offsets[v];
+    }
+
+    /**
+     * \brief Donne l'arc qui suit le dernier arc sortant de v
+     */
+    std::size_t endEdges(unsigned int v) const {
+        return m_offsets[v + 1];
+    }
+
+    /**
+     * \brief Donne le nombre de successeurs de v
+     */
+    std::size_t getNumberSuccessors(unsigned int v) const {
+        return m_offsets[v + 1] - m_offsets[v];
+    }
+
+    /**
+     * \brief Donne le sommet d'arrivée de l'arc e
+     */
+    unsigned int getSuccessor(std::size_t e) const {
+        return m_successors[e];
+    }
+
+    /**
+     * \brief Donne les poids (un par joueur) de l'arc e
+     */
+    const long* getWeights(std::size_t e) const {
+        return m_weights + e * m_nPlayers;
+    }
+
+    /**
+     * \brief Donne le joueur qui possède v
+     */
+    unsigned int getPlayer(unsigned int v) const {
+        return m_owners[v];
+    }
+
+    /**
+     * \brief Regarde si v est une cible pour le joueur donné
+     */
+    bool isTargetFor(unsigned int v, unsigned int player) const {
+        return (m_targets[v * m_targetWords + player / 64] >> (player % 64)) & 1;
+    }
+
+    /**
+     * \brief Regarde si v est une cible pour un joueur quelconque
+     */
+    bool isTarget(unsigned int v) const {
+        for (std::size_t i = 0 ; i < m_targetWords ; i++) {
+            if (m_targets[v * m_targetWords + i] != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const std::size_t* getOffsets() const {
+        return m_offsets;
+    }
+
+    const unsigned int* getSuccessors() const {
+        return m_successors;
+    }
+
+    const long* getWeights() const {
+        return m_weights;
+    }
+
+    const unsigned int* getOwners() const {
+        return m_owners;
+    }
+
+    const std::uint64_t* getTargets() const {
+        return m_targets;
+    }
+
+private:
+    std::size_t m_nVertices;
+    std::size_t m_nEdges;
+    std::size_t m_nPlayers;
+    std::size_t m_targetWords;
+    unsigned int m_init;
+    const std::size_t* m_offsets;
+    const unsigned int* m_successors;
+    const long* m_weights;
+    const unsigned int* m_owners;
+    const std::uint64_t* m_targets;
+    std::shared_ptr<const void> m_storage;
+};
+
+/**
+ * \brief Reçoit un jeu élément par élément.
+ * 
+ * Permet aux générateurs (et aux lecteurs de fichiers) de produire un jeu sans construire de Vertex : le récepteur décide de ce qu'il en fait (le stocker sous forme compacte, l'écrire dans un fichier, ...).
+ * 
+ * L'ordre des appels est : begin, puis setPlayer/addTarget/addEdge dans n'importe quel ordre, puis finish. Certains récepteurs imposent que les arcs arrivent triés selon leur sommet de départ.
+ */
+class GameSink {
+public:
+    virtual ~GameSink() {}
+
+    /**
+     * \brief Commence un nouveau jeu.
+     * 
+     * Tous les sommets appartiennent au joueur 0 et ne sont des cibles pour personne tant que rien d'autre n'est donné.
+     * \param nVertices Le nombre de sommets
+     * \param nPlayers Le nombre de joueurs
+     * \param init L'ID du sommet initial
+     */
+    virtual void begin(std::size_t nVertices, std::size_t nPlayers, unsigned int init) = 0;
+
+    /**
+     * \brief Donne le joueur qui possède un sommet
+     * \param vertex L'ID du sommet
+     * \param player Le joueur
+     */
+    virtual void setPlayer(unsigned int vertex, unsigned int player) = 0;
+
+    /**
+     * \brief Enregistre un sommet comme cible d'un joueur
+     * \param vertex L'ID du sommet
+     * \param player Le joueur
+     */
+    virtual void addTarget(unsigned int vertex, unsigned int player) = 0;
+
+    /**
+     * \brief Ajoute un arc
+     * \param from Le sommet de départ
+     * \param to Le sommet d'arrivée
+     * \param weights Les poids de l'arc (nPlayers valeurs)
+     */
+    virtual void addEdge(unsigned int from, unsigned int to, const long* weights) = 0;
+
+    /**
+     * \brief Termine le jeu
+     */
+    virtual void finish() = 0;
+};
+
+/**
+ * \brief Un récepteur qui construit un CompactGame.
+ * 
+ * Les arcs peuvent arriver dans n'importe quel ordre. S'ils ne sont pas triés selon leur sommet de départ, ils sont triés (tri par dénombrement, stable) lors de l'appel à finish.
+ */
+class CompactGameBuilder : public GameSink {
+public:
+    CompactGameBuilder();
+
+    void begin(std::size_t nVertices, std::size_t nPlayers, unsigned int init) override;
+    void setPlayer(unsigned int vertex, unsigned int player) override;
+    void addTarget(unsigned int vertex, unsigned int player) override;
+    void addEdge(unsigned int from, unsigned int to, const long* weights) override;
+    void finish() override;
+
+    /**
+     * \brief Donne le jeu construit. finish doit avoir été appelé
+     * \return Le jeu
+     */
+    CompactGame getGame() const;
+
+private:
+    struct Storage;
+
+    std::shared_ptr<Storage> m_storage;
+    std::vector<unsigned int> m_sources; // Sommet de départ de chaque arc, tant que finish n'a pas été appelé
+    bool m_sorted;
+    bool m_finished;
+};
\ No newline at end of file
@@ -31,7 +31,7 @@
 /**
  * \brief Représente un jeu Min-Max.
  * 
- * Le seul algorithme applicable sur ce jeu est DijkstraMinMax
+ * Le seul algorithme applicable sur ce jeu est DijkstraMinMax. Il suppose que les poids sont positifs : pour des poids négatifs, voir algorithms::solveMinMax
  */
 class MinMaxGame : public Game {
 public:
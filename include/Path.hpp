@@ -80,6 +80,11 @@ public:
 
     const std::shared_ptr<const Vertex> getLast() const;
 
+    /**
+     * \return Les sommets du chemin, dans l'ordre
+     */
+    const std::list<std::shared_ptr<const Vertex>>& getSteps() const;
+
     friend bool operator==(const Path& a, const Path &b);
 
     friend std::ostream& operator<<(std::ostream &os, const Path& a);
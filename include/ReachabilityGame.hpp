@@ -18,13 +18,23 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "Graph.hpp"
 #include "Player.hpp"
 #include "types/Long.hpp"
 #include "Game.hpp"
-#include "exploration/BestFirstSearch.hpp"
+#include "exploration/Node.hpp"
+
+namespace algorithms {
+    class CondensedMinMax;
+    class Symmetries;
+}
+
+namespace exploration {
+    class ForcedChains;
+}
 
 /**
  * \brief Un jeu d'atteignabilité
@@ -37,19 +47,35 @@ public:
 
     std::size_t getMaxLength() const;
 
+    /**
+     * \brief Dit si tous les poids du graphe sont positifs ou nuls
+     * \return Vrai si aucun poids n'est négatif
+     */
+    bool hasNonNegativeWeights() const;
+
+    /**
+     * \brief Donne, pour chaque joueur, le coût d'un chemin de longueur maximale dont chaque arc a le poids maximal du joueur.
+     * 
+     * C'est la borne utilisée par AStartPositive pour le coût restant d'un joueur.
+     * \return Une valeur par joueur
+     */
+    const std::vector<types::Long>& getMaxWeightsPath() const;
+
     /**
      * \brief Affiche dans la console le fichier DOT qui décrit le jeu.
      * 
-     * Marche uniquement pour les jeux à deux joueurs.
+     * Marche uniquement pour les jeux à deux joueurs. Pour un nombre quelconque de joueurs ou pour de grands jeux, voir io::writeDOT.
      */
     void printDOT() const;
 
     /**
-     * \brief L'heuristique A* positive telle que définie dans le projet/mémoire
+     * \brief L'heuristique A* positive telle que définie dans le projet/mémoire.
+     * 
+     * La distance restante de chaque joueur est lue dans getTargetDistances : l'évaluation coûte O(nombre de joueurs). Voir aussi exploration::heuristics::AStarPositive, qui évite l'appel au travers d'un heuristicSignature.
      * \param node Le noeud actuel de l'exploration
-     * \param costsMap Les coûts pour arriver à chaque cible
+     * \param costsMap Les coûts pour arriver à chaque cible (inutilisés, gardés pour respecter exploration::heuristicSignature)
      */
-    types::Long AStartPositive(const exploration::Node::Ptr& node, const exploration::CostsMap &costsMap);
+    types::Long AStartPositive(const exploration::Node::Ptr& node, const exploration::CostsMap &costsMap) const;
 
     /**
      * \brief Donne le pourcentage de sommets atteignables à partir du sommet initial
@@ -57,11 +83,68 @@ public:
      */
     std::size_t percentageOfReachableVertices() const;
 
+    /**
+     * \brief Donne les valeurs de la coalition contre le joueur (une valeur par sommet, les mêmes que MinMaxGame).
+     * 
+     * Les valeurs sont calculées par algorithms::CondensedMinMax : le graphe est condensé une seule fois pour tous les joueurs. Les poids négatifs sont acceptés (voir algorithms::solveMinMax). Les gros jeux (à partir de parallelCondensationSize sommets) résolvent les composantes indépendantes en parallèle, avec le nombre de threads donné par setCoalitionThreads (un seul par défaut).
+     * 
+     * Les valeurs sont calculées au premier appel puis gardées, et partagées avec les copies du jeu. Les appels peuvent venir de plusieurs threads. Le graphe ne doit donc plus être modifié après le premier appel.
+     * \param player Le joueur
+     * \return Les valeurs
+     */
+    const std::vector<types::Long>& getCoalitionValues(unsigned int player) const;
+
+    /**
+     * \brief Le nombre de sommets à partir duquel getCoalitionValues utilise plusieurs threads
+     */
+    static const std::size_t parallelCondensationSize = 1 << 16;
+
+    /**
+     * \brief Choisit le nombre de threads utilisés par getCoalitionValues sur un gros jeu. Les threads ne sont créés que pendant le calcul.
+     * 
+     * Seul le nombre donné avant le premier appel à getCoalitionValues compte. io::runEngine y met EngineOptions::nThreads.
+     * \param nThreads Le nombre de threads (0 pour le nombre de coeurs de la machine)
+     */
+    void setCoalitionThreads(std::size_t nThreads);
+
+    /**
+     * \brief Donne, pour chaque cible, les coûts minimaux pour y arriver (voir exploration::computeAllDijkstra).
+     * 
+     * Comme pour getCoalitionValues, les coûts sont calculés au premier appel puis gardés.
+     * \return Les coûts par cible
+     */
+    const exploration::CostsMap& getCostsMap() const;
+
+    /**
+     * \brief Donne, pour chaque joueur et chaque sommet, le coût minimal (avec les poids du joueur) pour aller du sommet à une des cibles du joueur.
+     * 
+     * La distance du sommet v pour le joueur p est à l'indice p * getGraph().size() + v. Elle est infinie si aucune cible n'est atteignable. Les distances sont calculées par un Dijkstra à sources multiples (les cibles du joueur) sur les arcs inversés, un par joueur, au premier appel puis gardées comme pour getCoalitionValues. Si un poids est négatif, un Bellman-Ford remplace le Dijkstra et la distance est -infini quand un cycle négatif permet de descendre indéfiniment avant d'atteindre une cible.
+     * \return Les distances
+     */
+    const std::vector<types::Long>& getTargetDistances() const;
+
+    /**
+     * \brief Donne les symétries du jeu (voir algorithms::Symmetries), cherchées au premier appel puis gardées comme pour getCoalitionValues
+     * \return Les symétries
+     */
+    const algorithms::Symmetries& getSymmetries() const;
+
+    /**
+     * \brief Donne les chaînes de coups forcés du jeu et le jeu contracté (voir exploration::ForcedChains), calculés au premier appel puis gardés comme pour getCoalitionValues.
+     * 
+     * Le jeu contracté garde ainsi ses propres valeurs en cache d'une résolution à l'autre. Les chemins donnés par ForcedChains::expand font référence à ce jeu.
+     * \return Les chaînes
+     */
+    const exploration::ForcedChains& getForcedChains() const;
+
     friend std::ostream& operator<<(std::ostream &os, const ReachabilityGame &game);
 
 private:
     std::vector<Player> m_players;
     std::vector<types::Long> m_maxWeightsPath;
+
+    struct Cache;
+    std::shared_ptr<Cache> m_cache;
 };
 
 std::ostream& operator<<(std::ostream &os, const ReachabilityGame &game);
\ No newline at end of file
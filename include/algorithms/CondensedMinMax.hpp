@@ -0,0 +1,93 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <vector>
+
+#include "CompactGame.hpp"
+#include "algorithms/Tarjan.hpp"
+#include "types/Long.hpp"
+
+namespace algorithms {
+    /**
+     * \brief Calcule les valeurs de coalition (les mêmes que DijkstraMinMax, voir MinMaxGame) composante fortement connexe par composante.
+     * 
+     * Le graphe est condensé une seule fois (tarjanIterative) : les composantes sont résolues dans l'ordre topologique inverse, si bien que les successeurs extérieurs à une composante ont déjà leur valeur quand on la traite. Dans une composante, un Dijkstra Min-Max local part de ces valeurs. Les composantes sont regroupées par niveau (un de plus que le plus grand niveau de leurs successeurs) : celles d'un même niveau sont indépendantes et sont résolues en parallèle.
+     * 
+     * Tout travaille sur des tableaux plats (CompactGame) : une résolution coûte O(E log V) pour un joueur, sans construire de graphe intermédiaire. Les poids doivent être positifs (voir solveMinMax pour des poids négatifs).
+     */
+    class CondensedMinMax {
+    public:
+        /**
+         * \brief Condense le graphe du jeu
+         * \param game Le jeu
+         * \param nThreads Le nombre de threads de chaque résolution. Si 0, on utilise le nombre de coeurs de la machine ; si 1, tout est fait dans le thread appelant. Les threads ne sont créés que pendant solve
+         */
+        explicit CondensedMinMax(const CompactGame &game, std::size_t nThreads = 1);
+
+        /**
+         * \brief Calcule les valeurs de coalition d'un joueur : le joueur minimise, les autres (réunis) maximisent
+         * \param player Le joueur
+         * \return La valeur de chaque sommet (infinie si le joueur ne peut pas forcer une visite de ses cibles)
+         */
+        std::vector<types::Long> solve(unsigned int player) const;
+
+        /**
+         * \brief Donne le jeu condensé
+         * \return Le jeu
+         */
+        const CompactGame& getGame() const {
+            return m_game;
+        }
+
+        /**
+         * \brief Donne le nombre de composantes fortement connexes
+         * \return Le nombre de composantes
+         */
+        std::size_t getNumberComponents() const {
+            return m_components.size();
+        }
+
+        /**
+         * \brief Donne le nombre de niveaux, c'est-à-dire le nombre d'étapes qui ne peuvent pas être faites en parallèle
+         * \return Le nombre de niveaux
+         */
+        std::size_t getNumberLevels() const {
+            return m_levelOffsets.size() - 1;
+        }
+
+    private:
+        void solveComponent(unsigned int player, std::size_t component, std::vector<long> &values) const;
+
+    private:
+        CompactGame m_game;
+        ComponentIndex m_components;
+        /** \brief Les arcs inversés, sous forme CSR : pour chaque arc inversé, le sommet de départ de l'arc d'origine et l'indice de cet arc */
+        std::vector<std::size_t> m_predecessorOffsets;
+        std::vector<unsigned int> m_predecessors;
+        std::vector<std::size_t> m_predecessorEdges;
+        /** \brief La position de chaque sommet dans sa composante */
+        std::vector<std::size_t> m_positions;
+        /** \brief Les composantes du niveau l sont levels[levelOffsets[l]], ..., levels[levelOffsets[l+1] - 1] */
+        std::vector<std::size_t> m_levelOffsets;
+        std::vector<std::size_t> m_levels;
+        std::size_t m_nThreads;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "algorithms/Tarjan.hpp"
+
+namespace algorithms {
+    /**
+     * \brief Maintient un ensemble de composantes fortement connexes que l'on fusionne deux à deux.
+     * 
+     * Les composantes sont accessibles par position (de 0 à size() - 1) en temps constant, ce qui permet d'en tirer une au hasard.
+     * 
+     * Fusionner deux composantes déplace les sommets de la plus petite dans la plus grande (union par taille). Une suite de fusions coûte donc O(V log V) au total.
+     * 
+     * La structure ne regarde pas le graphe : c'est à l'appelant de s'assurer que les arcs ajoutés rendent bien les deux composantes fusionnées fortement connexes (par exemple un arc de a vers b et un arc de b vers a).
+     */
+    class IncrementalComponents {
+    public:
+        /**
+         * \brief Construit la structure à partir des composantes calculées par Tarjan
+         * \param index Les composantes fortement connexes
+         */
+        explicit IncrementalComponents(const ComponentIndex& index);
+
+        /**
+         * \brief Donne le nombre de composantes
+         * \return Le nombre de composantes
+         */
+        std::size_t size() const;
+
+        /**
+         * \brief Donne les sommets de la composante à la position donnée
+         * \param position La position de la composante (dans [0, size()))
+         * \return Les sommets de la composante
+         */
+        const std::vector<unsigned int>& getComponent(std::size_t position) const;
+
+        /**
+         * \brief Donne la position de la composante qui contient le sommet
+         * \param vertex L'ID du sommet
+         * \return La position de sa composante
+         */
+        std::size_t positionOf(unsigned int vertex) const;
+
+        /**
+         * \brief Fusionne les composantes aux positions i et j.
+         * 
+         * Les positions des autres composantes peuvent changer.
+         * \param i La position d'une composante
+         * \param j La position d'une autre composante
+         * \return La position de la composante fusionnée
+         */
+        std::size_t merge(std::size_t i, std::size_t j);
+
+    private:
+        // Pour chaque sommet, l'emplacement de sa composante dans m_components
+        std::vector<unsigned int> m_slotOf;
+        // Les composantes. Un emplacement vidé par une fusion n'est plus jamais utilisé
+        std::vector<std::vector<unsigned int>> m_components;
+        // Les emplacements encore utilisés, dans l'ordre des positions
+        std::vector<unsigned int> m_alive;
+        // Pour chaque emplacement, sa position dans m_alive
+        std::vector<std::size_t> m_positionOfSlot;
+    };
+}
\ No newline at end of file
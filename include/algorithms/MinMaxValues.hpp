@@ -0,0 +1,82 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <vector>
+
+#include "CompactGame.hpp"
+#include "algorithms/CondensedMinMax.hpp"
+#include "types/Long.hpp"
+
+namespace algorithms {
+    /**
+     * \brief Les façons de calculer les valeurs de coalition
+     */
+    enum class MinMaxEngine {
+        /** \brief DijkstraMinMax (CondensedMinMax) : les poids du joueur sont positifs */
+        Dijkstra,
+        /** \brief DijkstraMinMax sur des poids rendus positifs par des potentiels (comme dans l'algorithme de Johnson) */
+        Potentials,
+        /** \brief Itération sur les valeurs à la Bellman-Ford : il y a un cycle de poids négatif */
+        ValueIteration
+    };
+
+    /**
+     * \brief Regarde si un arc a un poids négatif pour le joueur. Coûte O(E)
+     * \param game Le jeu
+     * \param player Le joueur
+     * \return Vrai si un poids est négatif
+     */
+    bool hasNegativeWeights(const CompactGame &game, unsigned int player);
+
+    /**
+     * \brief Calcule des potentiels h qui rendent positifs les poids du joueur, à la Johnson : w(u, v) + h(u) - h(v) >= 0 pour tout arc qui ne part pas d'une cible.
+     * 
+     * Toutes les cibles du joueur reçoivent le même potentiel : comme un chemin s'arrête à sa première cible, le coût de tout chemin de v vers une cible est décalé de h(v) - h(cible), et les valeurs du jeu aussi. Les arcs qui partent des cibles sont ignorés.
+     * 
+     * Les potentiels sont les plus courtes distances depuis une source fictive reliée à chaque sommet par un arc de poids nul (Bellman-Ford, O(VE) au pire).
+     * \param game Le jeu
+     * \param player Le joueur
+     * \param potentials Reçoit les potentiels
+     * \return Faux s'il existe un cycle de poids négatif qui ne passe par aucune cible (les potentiels n'existent pas)
+     */
+    bool computePotentials(const CompactGame &game, unsigned int player, std::vector<long> &potentials);
+
+    /**
+     * \brief Calcule les valeurs de coalition par itération sur les valeurs, pour des poids quelconques.
+     * 
+     * On part de 0 sur les cibles et de +infini ailleurs, et on applique min (joueur) ou max (coalition) sur les successeurs jusqu'à stabilisation. Une valeur finie est au moins -(V - 1) * W, avec W le plus grand poids en valeur absolue : une valeur qui descend plus bas vaut -infini (le joueur peut tourner dans un cycle négatif avant d'atteindre sa cible). Le nombre d'itérations est pseudo-polynomial. Voir ValueIteration, qui fait le calcul (en Gauss-Seidel, dans le thread appelant).
+     * \param game Le jeu
+     * \param player Le joueur
+     * \return La valeur de chaque sommet
+     */
+    std::vector<types::Long> valueIterationMinMax(const CompactGame &game, unsigned int player);
+
+    /**
+     * \brief Calcule les valeurs de coalition du joueur avec le moteur le plus rapide qui donne la bonne réponse.
+     * 
+     * Si aucun poids du joueur n'est négatif (vérifié en O(E)), on utilise directement condensed. Sinon, on cherche des potentiels (computePotentials) et on résout le jeu aux poids modifiés avec DijkstraMinMax ; s'il y a un cycle négatif, on passe à valueIterationMinMax.
+     * \param condensed Le jeu condensé
+     * \param player Le joueur
+     * \param engine Si non nul, reçoit le moteur utilisé
+     * \return La valeur de chaque sommet
+     */
+    std::vector<types::Long> solveMinMax(const CondensedMinMax &condensed, unsigned int player, MinMaxEngine *engine = nullptr);
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ReachabilityGame;
+
+namespace algorithms {
+    /**
+     * \brief Une symétrie d'un jeu : une permutation des sommets et une permutation des joueurs.
+     * 
+     * Le sommet v devient vertices[v] et le joueur p devient players[p]. Les propriétaires, les cibles et les poids sont préservés : le propriétaire de vertices[v] est players[propriétaire de v], vertices[v] est une cible de players[p] si et seulement si v est une cible de p, et l'arc vertices[u] -> vertices[v] existe avec le poids w pour players[p] si et seulement si l'arc u -> v existe avec le poids w pour p.
+     */
+    struct Automorphism {
+        std::vector<unsigned int> vertices;
+        std::vector<unsigned int> players;
+    };
+
+    /**
+     * \brief Cherche les symétries d'un jeu.
+     * 
+     * Un raffinement de couleurs (Weisfeiler-Leman de dimension 1) colore ensemble les sommets et les joueurs à partir des propriétaires, des cibles et des poids. Deux sommets de couleurs différentes ne peuvent pas être échangés par une symétrie. Pour deux sommets de même couleur, on individualise l'un dans une copie et l'autre dans une seconde copie, puis on raffine jusqu'à ce que toutes les couleurs soient distinctes ; la correspondance entre les couleurs des deux copies donne une permutation candidate, qui n'est gardée que si elle est vraiment une symétrie. La recherche est donc incomplète (certaines symétries peuvent manquer) mais toute symétrie trouvée est vérifiée.
+     * 
+     * Le groupe engendré par les symétries trouvées est ensuite énuméré, jusqu'à maxElements éléments.
+     */
+    class Symmetries {
+    public:
+        /**
+         * \brief Cherche les symétries du jeu
+         * \param game Le jeu
+         * \param maxElements Le nombre maximal d'éléments du groupe gardés
+         * \param maxAttempts Le nombre maximal de paires de sommets essayées
+         */
+        explicit Symmetries(const ReachabilityGame &game, std::size_t maxElements = 256, std::size_t maxAttempts = 64);
+
+        /**
+         * \brief Donne les éléments du groupe trouvés, sauf l'identité
+         * \return Les symétries
+         */
+        const std::vector<Automorphism>& getAutomorphisms() const {
+            return m_elements;
+        }
+
+        /**
+         * \brief Dit si aucune symétrie (autre que l'identité) n'a été trouvée
+         * \return Vrai si le jeu n'a pas de symétrie connue
+         */
+        bool empty() const {
+            return m_elements.empty();
+        }
+
+        /**
+         * \brief Donne la couleur stable de chaque sommet. Deux sommets de couleurs différentes ne sont jamais échangés par une symétrie
+         * \return Les couleurs
+         */
+        const std::vector<std::uint64_t>& getVertexColours() const {
+            return m_vertexColours;
+        }
+
+        /**
+         * \brief Donne la couleur stable de chaque joueur
+         * \return Les couleurs
+         */
+        const std::vector<std::uint64_t>& getPlayerColours() const {
+            return m_playerColours;
+        }
+
+    private:
+        std::vector<std::uint64_t> m_vertexColours;
+        std::vector<std::uint64_t> m_playerColours;
+        std::vector<Automorphism> m_elements;
+    };
+}
\ No newline at end of file
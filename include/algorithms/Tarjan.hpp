@@ -20,6 +20,7 @@
 
 #include <unordered_set>
 #include <set>
+#include <vector>
 
 #include "Vertex.hpp"
 #include "Graph.hpp"
@@ -37,12 +38,65 @@ namespace algorithms {
      */
     typedef std::unordered_set<stronglyConnectedComponent> stronglyConnectedComponents;
 
+    /**
+     * \brief Les composantes fortement connexes sous forme "plate".
+     * 
+     * Les composantes sont numérotées dans l'ordre où Tarjan les termine, c'est-à-dire dans un ordre topologique inverse du graphe condensé (une composante n'a d'arcs que vers des composantes de numéro inférieur ou égal).
+     * 
+     * Les sommets de la composante c sont members[offsets[c]], ..., members[offsets[c+1] - 1].
+     */
+    struct ComponentIndex {
+        /** \brief Pour chaque sommet, le numéro de sa composante */
+        std::vector<unsigned int> componentOf;
+        /** \brief Début de chaque composante dans members (taille : nombre de composantes + 1) */
+        std::vector<std::size_t> offsets;
+        /** \brief Les sommets, regroupés par composante */
+        std::vector<unsigned int> members;
+
+        /**
+         * \brief Donne le nombre de composantes
+         * \return Le nombre de composantes
+         */
+        std::size_t size() const {
+            return offsets.empty() ? 0 : offsets.size() - 1;
+        }
+
+        /**
+         * \brief Donne le nombre de sommets dans la composante c
+         * \param c Le numéro de la composante
+         * \return Le nombre de sommets de c
+         */
+        std::size_t componentSize(std::size_t c) const {
+            return offsets[c + 1] - offsets[c];
+        }
+    };
+
     /**
      * \brief Exécute l'algorithme de Tarjan sur le graphe.
      * \param graph Le graphe
      * \return L'ensemble des composantes fortement connexes du graphe
      */
     stronglyConnectedComponents tarjan(const Graph& graph);
+
+    /**
+     * \brief Exécute une version itérative de l'algorithme de Tarjan sur un graphe donné sous forme CSR.
+     * 
+     * Les successeurs du sommet v sont successors[offsets[v]], ..., successors[offsets[v+1] - 1].
+     * 
+     * La complexité est O(V+E) et la mémoire utilisée ne dépend que du nombre de sommets (aucune allocation par composante). La profondeur de la pile d'appels ne dépend pas du graphe.
+     * \param size Le nombre de sommets
+     * \param offsets Le tableau des débuts des listes de successeurs (taille : size + 1)
+     * \param successors Les successeurs
+     * \return Les composantes fortement connexes
+     */
+    ComponentIndex tarjanIterative(std::size_t size, const std::size_t* offsets, const unsigned int* successors);
+
+    /**
+     * \brief Exécute la version itérative de l'algorithme de Tarjan sur le graphe.
+     * \param graph Le graphe
+     * \return Les composantes fortement connexes
+     */
+    ComponentIndex tarjanIterative(const Graph& graph);
 }
 
 namespace std {
@@ -0,0 +1,83 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "CompactGame.hpp"
+#include "types/Long.hpp"
+#include "types/ThreadPool.hpp"
+
+namespace algorithms {
+    /**
+     * \brief Comment une passe de l'itération sur les valeurs lit les valeurs des successeurs
+     */
+    enum class Sweep {
+        /** \brief Toutes les nouvelles valeurs sont calculées à partir de celles de la passe précédente */
+        Jacobi,
+        /** \brief Les valeurs sont mises à jour sur place : une passe voit déjà les valeurs calculées avant elle */
+        GaussSeidel
+    };
+
+    /**
+     * \brief Calcule les valeurs de coalition (les mêmes que DijkstraMinMax, voir MinMaxGame) par itération sur les valeurs, sur des tableaux plats.
+     * 
+     * On part de 0 sur les cibles du joueur et de +infini ailleurs. Chaque passe remplace la valeur de chaque sommet par le min (sommets du joueur) ou le max (sommets de la coalition) du poids de l'arc plus la valeur du successeur. Les valeurs ne font que diminuer et l'itération s'arrête dès qu'une passe ne change plus rien. Avec des poids positifs, il faut au plus V passes ; chaque passe coûte O(E) et ne dépend que du diamètre du jeu, ce qui est avantageux sur les jeux denses de petit diamètre.
+     * 
+     * Les poids peuvent être négatifs : une valeur finie est au moins -(V - 1) * W, avec W le plus grand poids en valeur absolue, donc une valeur qui descend plus bas vaut -infini. Le nombre de passes est alors pseudo-polynomial.
+     * 
+     * Les sommets sont découpés en blocs consécutifs, répartis sur les threads à chaque passe. En Gauss-Seidel, les blocs traités en même temps lisent les valeurs des autres au fur et à mesure : les valeurs restent au-dessus de la solution et le résultat est le même.
+     */
+    class ValueIteration {
+    public:
+        /**
+         * \brief La taille par défaut d'un bloc de sommets
+         */
+        static const std::size_t defaultBlockSize = 1024;
+
+        /**
+         * \brief Prépare l'itération
+         * \param game Le jeu
+         * \param nThreads Le nombre de threads. Si 0, on utilise le nombre de coeurs de la machine ; si 1, tout est fait dans le thread appelant
+         * \param sweep Le type de passe
+         * \param blockSize Le nombre de sommets d'un bloc
+         */
+        explicit ValueIteration(const CompactGame &game, std::size_t nThreads = 1, Sweep sweep = Sweep::GaussSeidel, std::size_t blockSize = defaultBlockSize);
+
+        /**
+         * \brief Calcule les valeurs de coalition d'un joueur
+         * \param player Le joueur
+         * \param sweeps Si non nul, reçoit le nombre de passes faites (la dernière n'a rien changé)
+         * \return La valeur de chaque sommet
+         */
+        std::vector<types::Long> solve(unsigned int player, std::size_t *sweeps = nullptr) const;
+
+    private:
+        template <typename Read, typename Write>
+        bool sweepBlock(unsigned int player, std::size_t block, long lowest, Read &&read, Write &&write) const;
+
+    private:
+        CompactGame m_game;
+        Sweep m_sweep;
+        std::size_t m_blockSize;
+        std::unique_ptr<types::ThreadPool> m_pool;
+    };
+}
\ No newline at end of file
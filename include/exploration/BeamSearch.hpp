@@ -0,0 +1,40 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Path.hpp"
+#include "ReachabilityGame.hpp"
+#include "exploration/BestFirstSearch.hpp"
+
+namespace exploration {
+    /**
+     * \brief Exécute une recherche en faisceau (beam search) : à chaque profondeur, seuls les beamWidth meilleurs noeuds (selon l'heuristique) sont gardés.
+     * 
+     * Les noeuds sont développés comme dans bestFirstSearch (même filtre de Nash quand un joueur voit une cible). Les noeuds d'une profondeur sont développés en parallèle ; chaque thread garde ses beamWidth meilleurs successeurs et les threads sont fusionnés à la fin de la profondeur. En cas d'égalité, l'ordre de génération départage les noeuds : le résultat ne dépend pas du nombre de threads.
+     * 
+     * La recherche garde le meilleur équilibre trouvé et s'arrête quand plus aucun noeud du faisceau ne peut l'améliorer (si l'heuristique est admissible). Le résultat n'est pas forcément optimal puisque des noeuds sont oubliés, mais le temps et la mémoire sont bornés : au plus beamWidth noeuds (chacun avec son chemin) par thread à tout moment, et au plus game.getMaxLength() profondeurs.
+     * \param game Le jeu
+     * \param heuristic L'heuristique
+     * \param beamWidth Le nombre de noeuds gardés par profondeur (au moins 1)
+     * \param allowedTime Le temps permis en secondes. S'il est écoulé, le meilleur équilibre trouvé jusque là est renvoyé ; OutOfTime est lancée s'il n'y en a pas
+     * \param nThreads Le nombre de threads. Si 0, on utilise le nombre de coeurs de la machine
+     * \return Le meilleur équilibre de Nash trouvé
+     */
+    Path beamSearch(const ReachabilityGame &game, const heuristicSignature &heuristic, std::size_t beamWidth, types::Long allowedTime = types::Long::infinity, std::size_t nThreads = 1);
+}
\ No newline at end of file
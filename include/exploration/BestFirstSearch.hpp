@@ -18,14 +18,18 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
+#include <unordered_map>
 #include <vector>
 #include <map>
 
 #include "Vertex.hpp"
 #include "Path.hpp"
-
-class ReachabilityGame;
+#include "ReachabilityGame.hpp"
+#include "algorithms/Symmetries.hpp"
+#include "exploration/Frontier.hpp"
+#include "exploration/Node.hpp"
 
 /**
  * \brief Contient les algorithmes d'exploration
@@ -59,93 +63,328 @@ namespace exploration {
     };
 
     /**
-     * \brief Un état de l'exploration.
+     * \brief La signature qu'une fonction heuristique doit avoir.
      * 
-     * Contient le RP total, les coûts par joueur et l'ensemble des joueurs qui n'ont pas encore atteint une cible
+     * \param node Le noeud d'exploration pour lequel on veut calculer la valeur
+     * \param costsMap Pour chaque cible, contient les coûts minimaux pour y arriver par sommet du graphe
+     * \return La valeur de l'heuristique
      */
-    struct State {
-        State(std::size_t nPlayers) :
-            RP(0),
-            epsilon(nPlayers, 0)
-            {
-            for (unsigned int i = 0 ; i < nPlayers ; i++) {
-                notVisitedPlayers.insert(i);
-            }
-        }
+    typedef std::function<types::Long(const Node::Ptr& node, const CostsMap& costsMap)> heuristicSignature;
 
-        State(const State &state) :
-            RP(state.RP),
-            epsilon(state.epsilon),
-            notVisitedPlayers(state.notVisitedPlayers) {
+    /**
+     * \brief Calcule tous les coûts par Dijkstra.
+     * 
+     * Pour chacune des cibles du jeu, calcule les coûts pour y arriver à partir de chaque sommet. ReachabilityGame::getCostsMap garde le résultat.
+     * \param game Le jeu
+     * \return Une map qui associe à chaque cible un tableau de coût (une valeur par sommet)
+     */
+    CostsMap computeAllDijkstra(const ReachabilityGame &game);
 
+    /**
+     * \brief Les propriétés qu'une heuristique peut déclarer.
+     * 
+     * Une heuristique (voir bestFirstSearch) est un objet qu'on appelle comme heuristicSignature. Son type peut déclarer des constantes statiques :
+     *      - usesCostsMap : si false, l'exploration ne calcule pas ReachabilityGame::getCostsMap et passe une map vide. Par défaut, on suppose que les coûts sont nécessaires (c'est le cas de tout heuristicSignature) ;
+     *      - consistent : si true, l'heuristique est cohérente quand les poids sont positifs (h(n) <= c(n, n') + h(n') pour tout successeur n'). Par défaut, on ne suppose rien.
+     */
+    template <typename Heuristic>
+    struct HeuristicTraits {
+    private:
+        template <typename H>
+        static constexpr bool usesCostsMapOf(decltype(H::usesCostsMap)*) {
+            return H::usesCostsMap;
+        }
+        template <typename H>
+        static constexpr bool usesCostsMapOf(...) {
+            return true;
+        }
+        template <typename H>
+        static constexpr bool consistentOf(decltype(H::consistent)*) {
+            return H::consistent;
+        }
+        template <typename H>
+        static constexpr bool consistentOf(...) {
+            return false;
         }
 
-        /** \brief Somme de coûts */
-        types::Long RP;
-        /** \brief Coût par joueur jusqu'au sommet actuel */
-        std::vector<types::Long> epsilon;
-        /** \brief Ensemble des joueurs qui n'ont pas encore atteint leur objectif */
-        std::unordered_set<unsigned int> notVisitedPlayers;
+    public:
+        /** \brief Vrai si l'heuristique a besoin des coûts vers les cibles */
+        static constexpr bool usesCostsMap = usesCostsMapOf<Heuristic>(nullptr);
+        /** \brief Vrai si l'heuristique est cohérente (avec des poids positifs) */
+        static constexpr bool consistent = consistentOf<Heuristic>(nullptr);
     };
 
     /**
-     * \brief Un noeud de l'exploration
+     * \brief Donne les coûts vers les cibles si l'heuristique en a besoin, une map vide sinon
+     * \param game Le jeu
+     * \return Les coûts
      */
-    struct Node {
-        typedef std::shared_ptr<Node> Ptr;
-
-        Node(std::size_t nPlayers, Path p) :
-            state(nPlayers),
-            pathCost(0),
-            path(p)
-            {
+    template <typename Heuristic>
+    const CostsMap& costsMapFor(const ReachabilityGame &game) {
+        if constexpr (HeuristicTraits<Heuristic>::usesCostsMap) {
+            return game.getCostsMap();
         }
-
-        Node(State s, types::Long pcost, Path p) :
-            state(s),
-            pathCost(pcost),
-            path(p)
-            {
+        else {
+            static const CostsMap empty;
+            return empty;
         }
+    }
+
+    /**
+     * \brief Génère les successeurs d'un noeud de l'exploration, dans l'ordre des arcs du dernier sommet.
+     * 
+     * Un successeur qui fait voir une cible à un joueur pour la première fois n'est gardé que si le chemin est un équilibre de Nash pour ce joueur. Le coût (pathCost) de chaque successeur gardé est donné par l'heuristique.
+     * \param currentNode Le noeud à développer
+     * \param nPlayers Le nombre de joueurs
+     * \param heuristic L'heuristique
+     * \param costsMap Les coûts vers chaque cible
+     * \param allPlayers L'ensemble de tous les joueurs. Il est modifié pendant l'appel mais retrouve sa valeur à la fin : chaque thread doit avoir le sien
+     * \param add Appelée avec chaque successeur gardé
+     */
+    template <typename Heuristic, typename Add>
+    void expandNode(const Node::Ptr &currentNode, std::size_t nPlayers, const Heuristic &heuristic, const CostsMap &costsMap, std::unordered_set<unsigned int> &allPlayers, Add &&add) {
+        const std::shared_ptr<const Vertex> last = currentNode->path.getLast();
+
+        // On va itérer sur chaque successeur du dernier sommet du chemin
+        for (auto succEdge = last->cbegin() ; succEdge != last->cend() ; succEdge++) {
+            const Vertex::Ptr succ = succEdge->second.first.lock();
+            const std::vector<types::Long>& w = succEdge->second.second;
+
+            // On copie le noeud et on ajoute un pas
+            Node::Ptr newNode = std::make_shared<Node>(currentNode);
+            newNode->path.addStep(succ);
+
+            // On met à jour les coûts en ajoutant le coût de l'arc emprunté
+            for (std::size_t i = 0 ; i < nPlayers ; i++) {
+                newNode->state.epsilon[i] = w[i] + currentNode->state.epsilon[i];
+            }
 
-        Node(Node::Ptr node) :
-            state(node->state),
-            pathCost(node->pathCost),
-            path(node->path)
-            {
+            if (succ->isTarget()) {
+                std::unordered_set<unsigned int> newReached;
+                for (unsigned int p : newNode->state.notVisitedPlayers) {
+                    if (succ->isTargetFor(p)) {
+                        newReached.insert(p);
+                    }
+                }
 
+                if (newReached.size() != 0) {
+                    // On a des joueurs qui atteignent une cible pour la première fois
+                    bool nash = true;
+                    // On vérifie si on a un équilibre de Nash pour chaque joueur
+                    for (unsigned int p : newReached) {
+                        allPlayers.erase(p);
+                        if (!newNode->path.isANashEquilibrium(allPlayers)) {
+                            nash = false;
+                        }
+                        allPlayers.insert(p);
+                    }
+                    // Si oui, on va ajouter un nouveau noeud à la frontière
+                    if (nash) {
+                        for (unsigned int p : newReached) {
+                            newNode->state.notVisitedPlayers.erase(p);
+                            newNode->state.RP += newNode->state.epsilon[p];
+                        }
+                        newNode->pathCost = heuristic(newNode, costsMap);
+                        add(newNode);
+                    }
+                }
+                else {
+                    newNode->pathCost = heuristic(newNode, costsMap);
+                    add(newNode);
+                }
+            } 
+            else {
+                newNode->pathCost = heuristic(newNode, costsMap);
+                add(newNode);
+            }
         }
+    }
 
-        /** \brief L'état de l'exploration */
-        State state;
-        /** \brief Le coût pour arriver jusqu'à ce noeud de l'exploration */
-        types::Long pathCost;
-        /** \brief Le chemin emprunté */
-        Path path;
+    /**
+     * \brief Le nombre de fois qu'un même état de l'exploration peut être redéveloppé avec une heuristique non cohérente
+     */
+    const std::size_t maxReopenings = 4;
+
+    /**
+     * \brief Des informations sur le déroulement de bestFirstSearch
+     */
+    struct SearchStatistics {
+        /** \brief Le nombre de noeuds développés */
+        std::size_t expanded = 0;
+        /** \brief Le nombre de noeuds écartés car leur état avait déjà été développé avec un RP au plus aussi grand */
+        std::size_t pruned = 0;
+        /** \brief Le nombre d'états redéveloppés avec un RP plus petit */
+        std::size_t reopened = 0;
+        /** \brief Vrai si l'exploration a pu supposer l'heuristique cohérente jusqu'au bout */
+        bool consistent = false;
+        /** \brief Le nombre de symétries du jeu utilisées par la table de transposition (identité non comprise), 0 si elles ne sont pas cherchées */
+        std::size_t symmetries = 0;
+        /** \brief Le temps passé à chercher les symétries (nul si elles ne sont pas cherchées ou étaient déjà gardées par le jeu) */
+        std::chrono::steady_clock::duration symmetriesTime{};
     };
 
     /**
-     * \brief Pour chaque sommet, contient les coûts minimaux pour arriver vers un sommet donné
+     * \brief Met à jour la borne (State::bounds) du propriétaire du dernier sommet du chemin, s'il n'a pas encore atteint une cible
+     * \param node Le noeud
+     * \param game Le jeu
+     */
+    void updateBound(Node &node, const ReachabilityGame &game);
+
+    /**
+     * \brief Donne la clé de transposition d'un noeud : le dernier sommet, la longueur du chemin et, pour chaque joueur qui n'a pas encore atteint une cible, son coût et sa borne.
+     * 
+     * Deux noeuds de même clé ont exactement les mêmes continuations (mêmes coûts à venir, mêmes équilibres de Nash) : seul RP les distingue. La longueur fait partie de la clé car un chemin de longueur maximale est accepté même si des joueurs n'ont pas vu de cible : sans elle, un cycle de poids nul serait écarté et ce chemin ne serait jamais trouvé.
+     * \param node Le noeud
+     * \return La clé
      */
-    typedef std::vector<types::Long> CostsForATarget;
+    std::vector<long> transpositionKey(const Node &node);
+
     /**
-     * \brief Pour chaque sommet enregistré, contient un CostsForATarget vers ce sommet
+     * \brief Donne la forme canonique de la clé de transposition d'un noeud : la plus petite (dans l'ordre lexicographique) des images de sa clé par les symétries du jeu.
+     * 
+     * Deux noeuds qu'une symétrie échange ont la même forme canonique. Leurs continuations se correspondent par cette symétrie, avec les mêmes coûts à une permutation des joueurs près, donc le même coût total.
+     * \param node Le noeud
+     * \param symmetries Les symétries du jeu
+     * \return La clé canonique
      */
-    typedef std::unordered_map<Vertex::Ptr, CostsForATarget> CostsMap;
+    std::vector<long> transpositionKey(const Node &node, const algorithms::Symmetries &symmetries);
+
     /**
-     * \brief La signature qu'une fonction heuristique doit avoir.
+     * \brief Hachage d'une clé de transposition
+     */
+    struct TranspositionHash {
+        std::size_t operator()(const std::vector<long> &key) const {
+            std::size_t hash = key.size();
+            for (long value : key) {
+                hash ^= std::hash<long>{}(value) + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+            }
+            return hash;
+        }
+    };
+
+    /**
+     * \brief Exécute une exploration de type Best First Search avec l'heuristique donnée.
      * 
-     * \param node Le noeud d'exploration pour lequel on veut calculer la valeur
-     * \param costsMap Pour chaque cible, contient les coûts minimaux pour y arriver par sommet du graphe
-     * \return La valeur de l'heuristique
+     * L'heuristique est un paramètre du patron : son appel peut être mis en ligne, ce qui n'est pas possible au travers d'un heuristicSignature. Elle doit pouvoir être appelée comme heuristicSignature (voir exploration::heuristics pour des heuristiques toutes faites). Si elle n'a pas besoin des coûts vers les cibles, voir HeuristicTraits.
+     * 
+     * Les états déjà développés sont gardés dans une table de transposition (voir transpositionKey). Si l'heuristique se déclare cohérente et que les poids sont positifs, un état n'est jamais redéveloppé : le premier développement a le plus petit RP. Sinon, un état est redéveloppé quand on le retrouve avec un RP plus petit, au plus maxReopenings fois. L'exploration vérifie aussi que f ne diminue jamais d'un noeud à son successeur ; si c'est le cas, elle passe à la seconde politique.
+     * 
+     * Si useSymmetries est vrai, les clés sont mises sous forme canonique avec les symétries du jeu (ReachabilityGame::getSymmetries) : deux états symétriques ne sont développés qu'une fois. La recherche des symétries coûte plus que linéaire sur les gros jeux (et est payée même si le jeu n'en a pas), d'où le choix laissé à l'appelant. Une heuristique qui se déclare cohérente doit donc aussi donner la même valeur à deux états symétriques, ce qui est le cas des heuristiques de exploration::heuristics qui se déclarent cohérentes.
+     * \param game Le jeu
+     * \param heuristic L'heuristique
+     * \param allowedTime Le temps permis en secondes
+     * \param statistics Si non nul, reçoit des informations sur l'exploration
+     * \param tieBreaking Comment départager les noeuds de même coût (voir Frontier)
+     * \param useSymmetries Si vrai, les états symétriques sont confondus dans la table de transposition
      */
-    typedef std::function<types::Long(const Node::Ptr& node, const CostsMap& costsMap)> heuristicSignature;
+    template <typename Heuristic>
+    Path bestFirstSearch(const ReachabilityGame& game, const Heuristic& heuristic, types::Long allowedTime = types::Long::infinity, SearchStatistics *statistics = nullptr, TieBreaking tieBreaking = TieBreaking::Deepest, bool useSymmetries = false) {
+        std::size_t nPlayers = game.getGraph().getNumberPlayers();
+
+        // Les coûts sont gardés par le jeu : une deuxième exploration du même jeu ne les recalcule pas
+        const CostsMap &costsMap = costsMapFor<Heuristic>(game);
+
+        // On initialise le premier noeud de l'exploration
+        Path path(game, game.getInit());
+        Node::Ptr init = std::make_shared<Node>(nPlayers, path);
+        for (unsigned int player : game.getInit()->getTargetPlayers()) {
+            init->state.notVisitedPlayers.erase(player);
+        }
+        updateBound(*init, game);
+        init->pathCost = heuristic(init, costsMap);
+
+        // Les états déjà développés, avec le plus petit RP et le nombre de redéveloppements
+        std::unordered_map<std::vector<long>, std::pair<types::Long, std::size_t>, TranspositionHash> closed;
+        bool consistent = HeuristicTraits<Heuristic>::consistent && game.hasNonNegativeWeights();
+        SearchStatistics counters;
+        const algorithms::Symmetries *symmetries = nullptr;
+        if (useSymmetries) {
+            const auto symmetriesStart = std::chrono::steady_clock::now();
+            symmetries = &game.getSymmetries();
+            counters.symmetriesTime = std::chrono::steady_clock::now() - symmetriesStart;
+            counters.symmetries = symmetries->getAutomorphisms().size();
+        }
+        auto report = [&]() {
+            if (statistics) {
+                *statistics = counters;
+                statistics->consistent = consistent;
+            }
+        };
+
+        // On construit la frontière avec le noeud créé
+        Frontier frontier(tieBreaking);
+        frontier.push(init);
+
+        std::unordered_set<unsigned int> allPlayers;
+        for (unsigned int i = 0 ; i < nPlayers ; i++) {
+            allPlayers.insert(i);
+        }
+
+        auto start = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+        while(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count() - start < allowedTime) {
+            if (frontier.empty()) {
+                report();
+                throw EmptyFrontier("La frontière est vide");
+            }
+
+            Node::Ptr currentNode = frontier.pop();
+
+            if (currentNode->state.notVisitedPlayers.size() == 0) {
+                // Tout le monde a vu une cible. On a donc un équilibre de Nash (si exploration optimale)
+                report();
+                return currentNode->path;
+            }
+            else if (currentNode->path.size() == game.getMaxLength()) {
+                // On a atteint la longueur maximale
+                // Il se peut que ce soit un équilibre de Nash
+                // On va vérifier pour les joueurs qui n'ont pas encore atteint un objectif
+
+                if (currentNode->path.isANashEquilibrium(currentNode->state.notVisitedPlayers)) {
+                    // On a un EN
+                    report();
+                    return currentNode->path;
+                }
+            }
+            else {
+                auto transposition = closed.try_emplace(symmetries ? transpositionKey(*currentNode, *symmetries) : transpositionKey(*currentNode), currentNode->state.RP, 0);
+                if (!transposition.second) {
+                    // L'état a déjà été développé
+                    auto &entry = transposition.first->second;
+                    if (consistent || currentNode->state.RP >= entry.first || entry.second >= maxReopenings) {
+                        counters.pruned++;
+                        continue;
+                    }
+                    entry.first = currentNode->state.RP;
+                    entry.second++;
+                    counters.reopened++;
+                }
+
+                counters.expanded++;
+                expandNode(currentNode, nPlayers, heuristic, costsMap, allPlayers, [&](const Node::Ptr &newNode) {
+                    updateBound(*newNode, game);
+                    if (newNode->pathCost < currentNode->pathCost) {
+                        // f diminue : l'heuristique n'est pas cohérente sur ce jeu
+                        consistent = false;
+                    }
+                    frontier.push(newNode);
+                });
+            }
+        }
+        report();
+        throw OutOfTime("L'exploration s'est achevée par manque de temps");
+    }
 
     /**
-     * \brief Exécute une exploration de type Best First Search avec l'heuristique donnée
+     * \brief Exécute une exploration de type Best First Search avec une heuristique donnée sous forme de std::function.
+     * 
+     * Adaptateur vers la version patron, instanciée une seule fois dans la bibliothèque. Chaque évaluation passe par un appel indirect.
      * \param game Le jeu
      * \param heuristic L'heuristique
      * \param allowedTime Le temps permis en secondes
+     * \param statistics Si non nul, reçoit des informations sur l'exploration
+     * \param tieBreaking Comment départager les noeuds de même coût (voir Frontier)
+     * \param useSymmetries Si vrai, les états symétriques sont confondus dans la table de transposition
      */
-    Path bestFirstSearch(const ReachabilityGame& game, const heuristicSignature& heuristic, types::Long allowedTime = types::Long::infinity);
-}
\ No newline at end of file
+    Path bestFirstSearch(const ReachabilityGame& game, const heuristicSignature& heuristic, types::Long allowedTime = types::Long::infinity, SearchStatistics *statistics = nullptr, TieBreaking tieBreaking = TieBreaking::Deepest, bool useSymmetries = false);
+}
@@ -0,0 +1,48 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Path.hpp"
+#include "ReachabilityGame.hpp"
+#include "types/Long.hpp"
+
+namespace exploration {
+    /**
+     * \brief Quelques mesures d'une recherche bidirectionnelle
+     */
+    struct BidirectionalStatistics {
+        /** \brief Le nombre d'états fixés par les deux recherches */
+        std::size_t settled = 0;
+        /** \brief Vrai si bestFirstSearch a dû prendre le relais */
+        bool usedFallback = false;
+    };
+
+    /**
+     * \brief Cherche le meilleur équilibre de Nash d'un jeu à deux joueurs par une recherche bidirectionnelle.
+     * 
+     * Un état est un couple (sommet, ensemble des joueurs qui ont vu leur cible) ; un arc depuis un état coûte la somme des poids des joueurs qui n'ont pas encore vu leur cible, comme le RP de bestFirstSearch. Deux Dijkstra sont lancés en même temps : l'un en avant depuis le sommet initial, l'autre en arrière (sur les arcs inversés) depuis les états où les deux joueurs viennent de voir leur cible. Ils se rejoignent sur les états vus des deux côtés et s'arrêtent quand plus aucun chemin ne peut être plus court que le meilleur chemin joint.
+     * 
+     * Le chemin le plus court qui fait voir leur cible aux deux joueurs est ensuite testé : si c'est un équilibre de Nash, c'est le meilleur équilibre où les deux joueurs voient leur cible. Sinon, ou si aucun tel chemin n'existe, si le jeu n'a pas deux joueurs ou si des poids sont négatifs, bestFirstSearch avec AStartPositive prend le relais.
+     * \param game Le jeu
+     * \param allowedTime Le temps permis en secondes, pour la recherche bidirectionnelle et bestFirstSearch ensemble : bestFirstSearch ne reçoit que le temps qui reste, et OutOfTime est lancée s'il n'en reste plus
+     * \param statistics Si non nul, reçoit les mesures de la recherche
+     * \return Le meilleur équilibre de Nash
+     */
+    Path bidirectionalSearch(const ReachabilityGame &game, types::Long allowedTime = types::Long::infinity, BidirectionalStatistics *statistics = nullptr);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+
+#include "Path.hpp"
+#include "ReachabilityGame.hpp"
+#include "exploration/Frontier.hpp"
+#include "types/Long.hpp"
+
+namespace exploration {
+    /**
+     * \brief Les paramètres communs à tous les moteurs de résolution
+     */
+    struct EngineOptions {
+        /** \brief Le temps permis en secondes */
+        types::Long allowedTime = types::Long::infinity;
+        /** \brief Le nombre de chemins à générer (moteurs aléatoires) */
+        std::size_t nPaths = 1000;
+        /** \brief Le nombre de threads d'un moteur parallèle, et du calcul des valeurs de coalition d'un gros jeu (voir ReachabilityGame::setCoalitionThreads). Si 0, on utilise le nombre de coeurs de la machine */
+        std::size_t nThreads = 1;
+        /** \brief Le nombre de noeuds gardés par profondeur (recherche en faisceau) */
+        std::size_t beamWidth = 1000;
+        /** \brief Comment départager les noeuds de même coût (moteurs astar, uniform et patterns) */
+        TieBreaking tieBreaking = TieBreaking::Deepest;
+        /** \brief Si vrai, les moteurs astar, uniform et patterns confondent les états symétriques (voir bestFirstSearch). La recherche des symétries coûte cher sur les gros jeux */
+        bool symmetries = false;
+        /** \brief Le fichier où garder la base de motifs du moteur patterns (voir PatternDatabase::loadOrBuild). Si vide, la base est recalculée à chaque résolution */
+        std::string patternsFile;
+    };
+
+    /**
+     * \brief La signature d'un moteur de résolution : il renvoie le meilleur équilibre de Nash qu'il trouve.
+     * 
+     * Un moteur lance OutOfTime quand il n'a pas pu finir dans le temps permis.
+     */
+    typedef std::function<Path(ReachabilityGame &game, const EngineOptions &options)> engineSignature;
+
+    /**
+     * \brief Donne tous les moteurs connus, par nom
+     * \return Les moteurs
+     */
+    const std::map<std::string, engineSignature>& engines();
+
+    /**
+     * \brief Cherche un moteur par son nom
+     * \param name Le nom du moteur
+     * \return Le moteur
+     */
+    const engineSignature& findEngine(const std::string &name);
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Path.hpp"
+#include "ReachabilityGame.hpp"
+
+namespace exploration {
+    /**
+     * \brief Contracte les chaînes de coups forcés d'un jeu.
+     * 
+     * Un sommet est forcé s'il a exactement un successeur, n'est une cible pour aucun joueur et n'est pas le sommet de départ : son propriétaire n'a aucun choix. Une suite de sommets forcés est remplacée par un seul arc (un macro-arc) dont les poids sont, pour chaque joueur, la somme des poids de la chaîne. Le jeu contracté a donc moins de sommets, des chemins plus courts et une longueur maximale (getMaxLength) plus petite ; les valeurs de coalition des sommets gardés ne changent pas.
+     * 
+     * Un sommet forcé est quand même gardé s'il ferme un cycle de sommets forcés, ou si sa chaîne mènerait au même sommet qu'un autre arc partant du même sommet (un arc par paire de sommets).
+     * 
+     * La contrainte d'équilibre d'un sommet forcé (voir Path::isANashEquilibrium) est impliquée par celles des sommets qui le suivent sur le chemin : la retirer ne change pas les équilibres trouvés, sauf pour un chemin arrêté à la longueur maximale.
+     */
+    class ForcedChains {
+    public:
+        /**
+         * \brief Cherche les chaînes et construit le jeu contracté.
+         * 
+         * Le jeu doit vivre plus longtemps que l'objet.
+         * \param game Le jeu
+         */
+        explicit ForcedChains(const ReachabilityGame &game);
+
+        // Les chemins du jeu contracté gardent une référence vers lui
+        ForcedChains(const ForcedChains&) = delete;
+        ForcedChains& operator=(const ForcedChains&) = delete;
+
+        /**
+         * \brief Dit si aucun sommet n'a été retiré. Dans ce cas, getGame donne le jeu d'origine
+         * \return Vrai si le jeu n'a pas de chaîne à contracter
+         */
+        bool empty() const;
+
+        /**
+         * \brief Donne le nombre de sommets retirés
+         * \return Le nombre de sommets retirés
+         */
+        std::size_t getNumberRemoved() const;
+
+        /**
+         * \brief Donne le jeu contracté (ou le jeu d'origine si rien n'a été retiré)
+         * \return Le jeu
+         */
+        const ReachabilityGame& getGame() const;
+
+        /**
+         * \brief Remplace chaque macro-arc d'un chemin du jeu contracté par sa chaîne, pour obtenir le même chemin dans le jeu d'origine
+         * \param path Un chemin de getGame()
+         * \return Le chemin dans le jeu d'origine
+         */
+        Path expand(const Path &path) const;
+
+    private:
+        const ReachabilityGame &m_original;
+        std::unique_ptr<ReachabilityGame> m_contracted;
+        /** \brief Pour chaque sommet du jeu contracté, l'ID du sommet d'origine */
+        std::vector<unsigned int> m_originalIDs;
+        /** \brief Pour chaque macro-arc u -> v (clé u * 2^32 + v, IDs contractés), les sommets d'origine retirés entre u et v */
+        std::unordered_map<std::uint64_t, std::vector<unsigned int>> m_chains;
+    };
+
+    /**
+     * \brief Lance une recherche sur le jeu contracté et donne le chemin trouvé dans le jeu d'origine.
+     * 
+     * La recherche est appelée avec le jeu contracté (voir ForcedChains et ReachabilityGame::getForcedChains, qui garde la contraction entre les résolutions) : elle doit construire ses heuristiques sur ce jeu et renvoyer un de ses chemins. Si le chemin retrouvé dans game n'est pas un équilibre (ce qui ne peut arriver que pour un chemin arrêté à la longueur maximale), la recherche est relancée sur game avec le temps qui reste.
+     * \param game Le jeu
+     * \param allowedTime Le temps permis en secondes, pour les deux recherches ensemble
+     * \param search La recherche, appelée comme search(const ReachabilityGame&, types::Long tempsPermis)
+     * \return Le chemin trouvé, dans game
+     */
+    template <typename Search>
+    Path searchContracted(const ReachabilityGame &game, types::Long allowedTime, Search &&search) {
+        const ForcedChains &chains = game.getForcedChains();
+        if (chains.empty()) {
+            return search(game, allowedTime);
+        }
+        const auto start = std::chrono::steady_clock::now();
+        Path path = chains.expand(search(chains.getGame(), allowedTime));
+        if (!path.isANashEquilibrium()) {
+            if (!allowedTime.isInfinity()) {
+                const long elapsed = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+                allowedTime = std::max(allowedTime - elapsed, types::Long(0));
+            }
+            return search(game, allowedTime);
+        }
+        return path;
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "exploration/Node.hpp"
+#include "types/Long.hpp"
+
+namespace exploration {
+    /**
+     * \brief Comment départager les noeuds de même coût (pathCost) dans la frontière
+     */
+    enum class TieBreaking {
+        /** \brief Le noeud le plus profond (le plus long chemin) d'abord */
+        Deepest,
+        /** \brief Le noeud où le plus de joueurs ont déjà atteint une cible d'abord, puis le plus profond */
+        MostReached,
+        /** \brief Le noeud dont l'estimation du coût restant (pathCost - g) est la plus petite d'abord, puis le plus profond */
+        LowestHeuristic
+    };
+
+    /**
+     * \brief Donne la règle de départage correspondant à un nom (depth, reached ou h)
+     * \param name Le nom
+     * \return La règle
+     */
+    TieBreaking parseTieBreaking(const std::string &name);
+
+    /**
+     * \brief La frontière d'une exploration Best First Search.
+     * 
+     * Les noeuds sont rangés dans un seau par valeur de pathCost, et les seaux sont triés. Dans un seau, un tas trie les noeuds selon la règle de départage, puis du plus profond au moins profond et enfin dans l'ordre d'arrivée (les successeurs d'un noeud sortent donc dans l'ordre des arcs). Sur les jeux à poids unitaires, où beaucoup de noeuds ont le même coût, l'exploration descend ainsi le long d'un chemin au lieu de parcourir tout le plateau en largeur.
+     */
+    class Frontier {
+    public:
+        /**
+         * \param tieBreaking La règle de départage
+         */
+        explicit Frontier(TieBreaking tieBreaking = TieBreaking::Deepest);
+
+        /**
+         * \brief Ajoute un noeud. Son pathCost doit être calculé
+         * \param node Le noeud
+         */
+        void push(const Node::Ptr &node);
+
+        /**
+         * \brief Retire et donne le noeud de plus petit coût (départagé par la règle)
+         * \return Le noeud
+         */
+        Node::Ptr pop();
+
+        bool empty() const {
+            return m_size == 0;
+        }
+
+        std::size_t size() const {
+            return m_size;
+        }
+
+    private:
+        /**
+         * \brief Un noeud avec sa clé de départage, sa profondeur et son ordre d'arrivée
+         */
+        struct Entry {
+            long key;
+            std::size_t depth;
+            std::size_t order;
+            Node::Ptr node;
+        };
+
+        long tieKey(const Node &node) const;
+
+        TieBreaking m_tieBreaking;
+        std::map<types::Long, std::vector<Entry>> m_buckets;
+        std::size_t m_size;
+        std::size_t m_order;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "CompactGame.hpp"
+#include "ReachabilityGame.hpp"
+#include "types/AliasTable.hpp"
+
+namespace exploration {
+    /**
+     * \brief Choisit les successeurs d'une marche aléatoire en favorisant ceux qui rapprochent un joueur de ses cibles.
+     * 
+     * Pour un sommet v et un joueur p, l'arc e = (v, w) a le score s(e) = poids_p(e) + d_p(w), où d_p(w) est le coût minimal de w vers une cible de p (ReachabilityGame::getTargetDistances). L'arc est tiré avec une probabilité
+     *      (1 - exploration) * exp(-(s(e) - min s) / temperature) / Z + exploration / degré(v)
+     * c'est-à-dire un softmin mélangé avec un peu de choix uniforme pour que tous les arcs restent possibles. Si aucune cible de p n'est atteignable depuis les successeurs, le choix est uniforme. Si des successeurs sont à une distance -infini (un cycle négatif), le softmin se limite à eux.
+     * 
+     * Une table d'alias est construite pour chaque couple (sommet, joueur) : un tirage se fait en O(1). La mémoire utilisée est O(E * P).
+     * 
+     * Le jeu et sa version compacte doivent vivre plus longtemps que l'objet.
+     */
+    class GuidedSampler {
+    public:
+        /**
+         * \brief Construit les tables d'alias
+         * \param game Le jeu
+         * \param compact La version compacte du jeu (avec les mêmes numéros de sommets)
+         * \param temperature La température du softmin. Plus elle est basse, plus les arcs de score minimal sont favorisés
+         * \param exploration La part de choix uniforme, dans [0, 1]
+         */
+        GuidedSampler(const ReachabilityGame &game, const CompactGame &compact, double temperature = 1., double exploration = 0.05);
+
+        /**
+         * \brief Tire un arc sortant de v en guidant le joueur player
+         * \param v Le sommet
+         * \param player Le joueur à guider vers ses cibles
+         * \param generator Le générateur aléatoire
+         * \return L'indice de l'arc dans le jeu compact, ou m_compact.endEdges(v) si v n'a aucun successeur
+         */
+        template<typename Generator>
+        std::size_t choose(unsigned int v, unsigned int player, Generator &generator) const {
+            const std::size_t begin = m_compact.beginEdges(v), degree = m_compact.getNumberSuccessors(v);
+            if (degree == 0) {
+                return m_compact.endEdges(v);
+            }
+            if (degree == 1) {
+                return begin;
+            }
+            const std::size_t table = player * m_compact.getNumberEdges() + begin;
+            return begin + types::aliasTable::draw(m_probabilities.data() + table, m_aliases.data() + table, degree, generator);
+        }
+
+        /**
+         * \brief Donne le coût minimal de v vers une cible de player
+         * \param v Le sommet
+         * \param player Le joueur
+         * \return Le coût (infini si aucune cible n'est atteignable)
+         */
+        const types::Long& getDistance(unsigned int v, unsigned int player) const {
+            return m_distances[player * m_compact.size() + v];
+        }
+
+    private:
+        const CompactGame &m_compact;
+        const std::vector<types::Long> &m_distances;
+        std::vector<float> m_probabilities;
+        std::vector<unsigned int> m_aliases;
+    };
+}
\ No newline at end of file
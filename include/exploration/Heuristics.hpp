@@ -0,0 +1,201 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "ReachabilityGame.hpp"
+#include "exploration/Node.hpp"
+#include "exploration/PatternDatabase.hpp"
+#include "types/Long.hpp"
+
+namespace exploration {
+    /**
+     * \brief Des heuristiques toutes faites pour bestFirstSearch.
+     * 
+     * Chaque heuristique s'appelle comme heuristicSignature et renvoie g(n) + h(n), où g(n) est donné par accumulatedCost. Aucune ne lit les coûts vers les cibles (usesCostsMap vaut false) : bestFirstSearch ne calcule donc pas ReachabilityGame::getCostsMap. Celles qui déclarent consistent sont cohérentes quand les poids sont positifs (voir HeuristicTraits).
+     */
+    namespace heuristics {
+        /**
+         * \brief Le coût g(n) déjà payé : RP plus les coûts partiels des joueurs qui n'ont pas encore atteint une cible
+         * \param node Le noeud de l'exploration
+         * \return g(n)
+         */
+        inline types::Long accumulatedCost(const Node &node) {
+            types::Long g = node.state.RP;
+            for (unsigned int notReached : node.state.notVisitedPlayers) {
+                g += node.state.epsilon[notReached];
+            }
+            return g;
+        }
+
+        /**
+         * \brief L'heuristique nulle : h(n) = 0. L'exploration se fait alors par coût uniforme
+         */
+        struct Zero {
+            static constexpr bool usesCostsMap = false;
+            static constexpr bool consistent = true;
+
+            types::Long operator()(const Node::Ptr &node, const CostsMap &) const {
+                return accumulatedCost(*node);
+            }
+        };
+
+        /**
+         * \brief L'heuristique A* positive (voir ReachabilityGame::AStartPositive).
+         * 
+         * h(n) est la somme, sur les joueurs qui n'ont pas encore atteint une cible, de la distance vers leurs cibles (ReachabilityGame::getTargetDistances), bornée par ce qu'il leur reste à payer au pire.
+         * 
+         * Le jeu doit vivre plus longtemps que l'objet.
+         */
+        class AStarPositive {
+        public:
+            static constexpr bool usesCostsMap = false;
+            static constexpr bool consistent = true;
+
+            /**
+             * \brief Calcule (ou reprend du cache du jeu) les distances vers les cibles
+             * \param game Le jeu
+             */
+            explicit AStarPositive(const ReachabilityGame &game) :
+                m_distances(game.getTargetDistances()),
+                m_maxWeightsPath(game.getMaxWeightsPath()),
+                m_size(game.getGraph().size()) {
+            }
+
+            types::Long operator()(const Node::Ptr &node, const CostsMap &) const {
+                const std::size_t vertex = node->path.getLast()->getID();
+                types::Long h = 0;
+                for (unsigned int notReached : node->state.notVisitedPlayers) {
+                    h += remaining(*node, notReached, vertex);
+                }
+                return accumulatedCost(*node) + h;
+            }
+
+        protected:
+            /**
+             * \brief Minore le coût qu'il reste à payer au joueur pour atteindre une cible à partir du sommet
+             * \param node Le noeud de l'exploration
+             * \param player Le joueur
+             * \param vertex L'identifiant du dernier sommet du chemin
+             * \return La borne
+             */
+            types::Long remaining(const Node &node, unsigned int player, std::size_t vertex) const {
+                return std::min(m_distances[player * m_size + vertex], m_maxWeightsPath[player] - node.state.epsilon[player]);
+            }
+
+        private:
+            const std::vector<types::Long> &m_distances;
+            const std::vector<types::Long> &m_maxWeightsPath;
+            const std::size_t m_size;
+        };
+
+        /**
+         * \brief Variante de AStarPositive qui ne garde que le plus grand coût restant parmi les joueurs.
+         * 
+         * h(n) est plus petit qu'avec AStarPositive (donc toujours admissible) : l'exploration développe plus de noeuds mais peut servir de référence.
+         */
+        class MaxOverPlayers : public AStarPositive {
+        public:
+            static constexpr bool usesCostsMap = false;
+            static constexpr bool consistent = true;
+
+            explicit MaxOverPlayers(const ReachabilityGame &game) :
+                AStarPositive(game) {
+            }
+
+            types::Long operator()(const Node::Ptr &node, const CostsMap &) const {
+                const std::size_t vertex = node->path.getLast()->getID();
+                types::Long h = 0;
+                for (unsigned int notReached : node->state.notVisitedPlayers) {
+                    h = std::max(h, remaining(*node, notReached, vertex));
+                }
+                return accumulatedCost(*node) + h;
+            }
+        };
+    
+        /**
+         * \brief Variante de AStarPositive renforcée par une base de motifs sur les paires de joueurs (voir PatternDatabase).
+         * 
+         * Les joueurs qui n'ont pas encore atteint une cible sont groupés en paires disjointes : chaque paire compte son coût joint au lieu de la somme de ses deux distances. Comme les paires sont disjointes, la somme reste admissible, et elle n'est jamais plus petite que AStarPositive. Les paires sont choisies gloutonnement, du plus grand gain au plus petit : l'évaluation coûte O(k² log k) pour k joueurs restants.
+         * 
+         * Le jeu et la base doivent vivre plus longtemps que l'objet.
+         */
+        class PairPatterns : public AStarPositive {
+        public:
+            static constexpr bool usesCostsMap = false;
+            // Les paires choisies changent d'un noeud à l'autre : la somme peut diminuer plus vite que le coût des arcs
+            static constexpr bool consistent = false;
+
+            /**
+             * \param game Le jeu
+             * \param database La base de motifs du jeu
+             */
+            PairPatterns(const ReachabilityGame &game, const PatternDatabase &database) :
+                AStarPositive(game),
+                m_database(database),
+                m_maxWeightsPath(game.getMaxWeightsPath()) {
+            }
+
+            types::Long operator()(const Node::Ptr &node, const CostsMap &) const {
+                const std::size_t vertex = node->path.getLast()->getID();
+                const std::vector<unsigned int> players(node->state.notVisitedPlayers.begin(), node->state.notVisitedPlayers.end());
+                std::vector<types::Long> alone(players.size());
+                types::Long h = 0;
+                for (std::size_t a = 0 ; a < players.size() ; a++) {
+                    alone[a] = remaining(*node, players[a], vertex);
+                    h += alone[a];
+                }
+                if (h == types::Long::infinity) {
+                    return h;
+                }
+
+                // Ce que chaque paire ajoute à la somme des distances indépendantes
+                std::vector<std::tuple<types::Long, std::size_t, std::size_t>> gains;
+                for (std::size_t a = 0 ; a < players.size() ; a++) {
+                    for (std::size_t b = a + 1 ; b < players.size() ; b++) {
+                        const unsigned int i = players[a], j = players[b];
+                        const types::Long joint = std::min(m_database.getJointCost(i, j, vertex), m_maxWeightsPath[i] - node->state.epsilon[i] + m_maxWeightsPath[j] - node->state.epsilon[j]);
+                        if (joint > alone[a] + alone[b]) {
+                            gains.emplace_back(joint - alone[a] - alone[b], a, b);
+                        }
+                    }
+                }
+                std::stable_sort(gains.begin(), gains.end(), [](const auto &x, const auto &y) {
+                    return std::get<0>(x) > std::get<0>(y);
+                });
+                std::vector<bool> paired(players.size(), false);
+                for (const auto &gain : gains) {
+                    if (!paired[std::get<1>(gain)] && !paired[std::get<2>(gain)]) {
+                        paired[std::get<1>(gain)] = paired[std::get<2>(gain)] = true;
+                        h += std::get<0>(gain);
+                    }
+                }
+                return accumulatedCost(*node) + h;
+            }
+
+        private:
+            const PatternDatabase &m_database;
+            const std::vector<types::Long> &m_maxWeightsPath;
+        };
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Vertex.hpp"
+#include "Path.hpp"
+#include "types/Long.hpp"
+
+namespace exploration {
+    /**
+     * \brief Un état de l'exploration.
+     * 
+     * Contient le RP total, les coûts par joueur et l'ensemble des joueurs qui n'ont pas encore atteint une cible
+     */
+    struct State {
+        State(std::size_t nPlayers) :
+            RP(0),
+            epsilon(nPlayers, 0),
+            bounds(nPlayers, types::Long::infinity)
+            {
+            for (unsigned int i = 0 ; i < nPlayers ; i++) {
+                notVisitedPlayers.insert(i);
+            }
+        }
+
+        State(const State &state) :
+            RP(state.RP),
+            epsilon(state.epsilon),
+            bounds(state.bounds),
+            notVisitedPlayers(state.notVisitedPlayers) {
+
+        }
+
+        /** \brief Somme de coûts */
+        types::Long RP;
+        /** \brief Coût par joueur jusqu'au sommet actuel */
+        std::vector<types::Long> epsilon;
+        /**
+         * \brief Par joueur qui n'a pas encore atteint une cible, le plus petit (valeur de la coalition + coût) sur les sommets du joueur déjà parcourus.
+         * 
+         * Le chemin n'est un équilibre de Nash pour ce joueur que si son coût quand il atteint une cible ne dépasse pas cette borne. Tenu à jour par bestFirstSearch (voir updateBound).
+         */
+        std::vector<types::Long> bounds;
+        /** \brief Ensemble des joueurs qui n'ont pas encore atteint leur objectif */
+        std::unordered_set<unsigned int> notVisitedPlayers;
+    };
+
+    /**
+     * \brief Un noeud de l'exploration
+     */
+    struct Node {
+        typedef std::shared_ptr<Node> Ptr;
+
+        Node(std::size_t nPlayers, Path p) :
+            state(nPlayers),
+            pathCost(0),
+            path(p)
+            {
+        }
+
+        Node(State s, types::Long pcost, Path p) :
+            state(s),
+            pathCost(pcost),
+            path(p)
+            {
+        }
+
+        Node(Node::Ptr node) :
+            state(node->state),
+            pathCost(node->pathCost),
+            path(node->path)
+            {
+
+        }
+
+        /** \brief L'état de l'exploration */
+        State state;
+        /** \brief Le coût pour arriver jusqu'à ce noeud de l'exploration */
+        types::Long pathCost;
+        /** \brief Le chemin emprunté */
+        Path path;
+    };
+
+    /**
+     * \brief Pour chaque sommet, contient les coûts minimaux pour arriver vers un sommet donné
+     */
+    typedef std::vector<types::Long> CostsForATarget;
+    /**
+     * \brief Pour chaque sommet enregistré, contient un CostsForATarget vers ce sommet
+     */
+    typedef std::unordered_map<Vertex::Ptr, CostsForATarget> CostsMap;
+}
\ No newline at end of file
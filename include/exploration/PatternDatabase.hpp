@@ -0,0 +1,103 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ReachabilityGame.hpp"
+#include "types/Long.hpp"
+
+namespace exploration {
+    /**
+     * \brief Une base de motifs (pattern database) sur les paires de joueurs.
+     * 
+     * Pour chaque paire de joueurs {i, j} et chaque sommet v, la base garde le coût joint minimal pour que i et j atteignent tous deux une de leurs cibles en partant de v : chaque joueur paie ses poids jusqu'à sa première cible, et les deux joueurs suivent le même chemin. Ce coût est au moins la somme des distances indépendantes de ReachabilityGame::getTargetDistances, et il est plus grand quand les cibles des deux joueurs sont dans des directions différentes.
+     * 
+     * Le calcul fait un Dijkstra à sources multiples par paire sur les arcs inversés : O(P² E log V) pour P joueurs. Les valeurs sont gardées dans un seul tableau d'entiers 64 bits (P(P-1)/2 * V valeurs), qu'on peut écrire dans un fichier à côté du jeu pour ne pas le recalculer. Les poids doivent être positifs.
+     */
+    class PatternDatabase {
+    public:
+        /**
+         * \brief Calcule la base du jeu
+         * \param game Le jeu
+         * \throws std::runtime_error si un poids du jeu est négatif
+         */
+        explicit PatternDatabase(const ReachabilityGame &game);
+
+        /**
+         * \brief Relit une base écrite par save.
+         * 
+         * Le fichier garde une empreinte du jeu (sommets, propriétaires, cibles, arcs et poids) : une base calculée pour un autre jeu est refusée.
+         * \param game Le jeu
+         * \param path Le chemin du fichier
+         * \return La base
+         */
+        static PatternDatabase load(const ReachabilityGame &game, const std::string &path);
+
+        /**
+         * \brief Relit la base si le fichier existe et correspond au jeu ; sinon, la calcule et l'écrit dans le fichier
+         * \param game Le jeu
+         * \param path Le chemin du fichier
+         * \return La base
+         */
+        static PatternDatabase loadOrBuild(const ReachabilityGame &game, const std::string &path);
+
+        /**
+         * \brief Écrit la base dans un fichier binaire
+         * \param path Le chemin du fichier
+         */
+        void save(const std::string &path) const;
+
+        /**
+         * \brief Donne le coût joint minimal pour que les deux joueurs atteignent une cible à partir du sommet
+         * \param i Un joueur
+         * \param j Un autre joueur
+         * \param vertex L'identifiant du sommet
+         * \return Le coût, infini si un des deux joueurs ne peut plus atteindre de cible
+         */
+        types::Long getJointCost(unsigned int i, unsigned int j, unsigned int vertex) const {
+            const std::int64_t value = m_joint[pairIndex(i, j) * m_size + vertex];
+            return value == unreachable ? types::Long::infinity : types::Long(value);
+        }
+
+        std::size_t getNumberPlayers() const {
+            return m_nPlayers;
+        }
+
+    private:
+        PatternDatabase() = default;
+
+        std::size_t pairIndex(unsigned int i, unsigned int j) const {
+            if (i > j) {
+                std::swap(i, j);
+            }
+            return i * (2 * m_nPlayers - i - 1) / 2 + (j - i - 1);
+        }
+
+        static const std::int64_t unreachable;
+
+        std::size_t m_size;
+        std::size_t m_nPlayers;
+        std::uint64_t m_fingerprint;
+        std::vector<std::int64_t> m_joint;
+    };
+}
\ No newline at end of file
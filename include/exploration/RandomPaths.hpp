@@ -18,8 +18,11 @@
 
 #pragma once
 
+#include <random>
+
 #include "Path.hpp"
 #include "ReachabilityGame.hpp"
+#include "exploration/BestFirstSearch.hpp"
 
 namespace exploration {
     /**
@@ -38,9 +41,50 @@ namespace exploration {
     /**
      * \brief Génère un certain nombre de chemins aléatoires et garde le meilleur équilibre de Nash.
      * 
+     * Le meilleur équilibre est celui qui permet au plus de joueurs de voir leur cible puis, à nombre égal, celui dont la somme des coûts de ces joueurs est la plus petite. Seul le meilleur équilibre vu jusque là est gardé en mémoire.
+     * 
+     * Chaque chemin est abandonné dès qu'il ne peut plus être un équilibre et s'arrête quand tous les joueurs ont vu leur cible (voir RandomWalk::walkEquilibrium) : le chemin renvoyé peut donc être plus court que game.getMaxLength().
      * \param game Le jeu
      * \param nPaths Le nombre de chemins à générer
      * \return Le meilleur équilibire de Nash 
      */
     Path randomPath(const ReachabilityGame &game, std::size_t nPaths);
+
+    /**
+     * \brief Comme la fonction précédente mais arrête de générer des chemins quand le temps est écoulé.
+     * 
+     * Si le temps est écoulé, le meilleur équilibre de Nash trouvé jusque là est renvoyé. Si aucun n'a été trouvé, OutOfTime est lancée.
+     * \param game Le jeu
+     * \param nPaths Le nombre maximal de chemins à générer
+     * \param allowedTime Le temps permis en secondes
+     * \return Le meilleur équilibre de Nash
+     */
+    Path randomPath(const ReachabilityGame &game, std::size_t nPaths, types::Long allowedTime);
+
+    /**
+     * \brief Comme randomPath mais répartit la génération des chemins sur plusieurs threads.
+     * 
+     * Chaque thread a son propre générateur aléatoire (initialisé à partir de seed et du numéro du thread) et ne garde que son meilleur équilibre ; les meilleurs équilibres des threads sont comparés à la fin. La mémoire utilisée dépend donc du nombre de threads et pas du nombre de chemins.
+     * \param game Le jeu
+     * \param nPaths Le nombre maximal de chemins à générer
+     * \param allowedTime Le temps permis en secondes
+     * \param nThreads Le nombre de threads. Si 0, on utilise le nombre de coeurs de la machine
+     * \param seed La graine des générateurs aléatoires
+     * \return Le meilleur équilibre de Nash
+     */
+    Path parallelRandomPath(const ReachabilityGame &game, std::size_t nPaths, types::Long allowedTime = types::Long::infinity, std::size_t nThreads = 0, unsigned int seed = std::random_device()());
+
+    /**
+     * \brief Comme parallelRandomPath mais les successeurs sont tirés par un GuidedSampler plutôt qu'uniformément.
+     * 
+     * Les marches se dirigent vers les cibles des joueurs qui ne les ont pas encore vues, ce qui produit beaucoup plus d'équilibres quand les cibles sont rares.
+     * \param game Le jeu
+     * \param nPaths Le nombre maximal de chemins à générer
+     * \param allowedTime Le temps permis en secondes
+     * \param nThreads Le nombre de threads. Si 0, on utilise le nombre de coeurs de la machine
+     * \param seed La graine des générateurs aléatoires
+     * \param temperature La température du softmin (voir GuidedSampler)
+     * \return Le meilleur équilibre de Nash
+     */
+    Path guidedRandomPath(const ReachabilityGame &game, std::size_t nPaths, types::Long allowedTime = types::Long::infinity, std::size_t nThreads = 0, unsigned int seed = std::random_device()(), double temperature = 1.);
 }
\ No newline at end of file
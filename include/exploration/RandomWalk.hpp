@@ -0,0 +1,285 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "CompactGame.hpp"
+#include "exploration/GuidedSampler.hpp"
+#include "Path.hpp"
+#include "ReachabilityGame.hpp"
+
+namespace exploration {
+    /**
+     * \brief Génère des marches aléatoires sur la représentation compacte d'un jeu.
+     * 
+     * Une marche part du sommet initial et choisit chaque successeur uniformément, en O(1) grâce aux tableaux CSR. Les sommets visités, les coûts des joueurs et les joueurs qui ont vu leur cible sont mis à jour à chaque pas, dans des tableaux réutilisés d'une marche à l'autre : une marche n'alloue pas de mémoire.
+     * 
+     * Les coûts suivent les mêmes règles que Path : le coût d'un joueur cesse d'augmenter quand il voit une de ses cibles.
+     * 
+     * Un objet ne doit être utilisé que par un seul thread à la fois. Le jeu et sa version compacte doivent vivre plus longtemps que l'objet.
+     */
+    class RandomWalk {
+    public:
+        /**
+         * \brief Prépare les tableaux pour des marches dans le jeu
+         * \param game Le jeu (pour les valeurs de coalition et la conversion en Path)
+         * \param compact La version compacte du jeu (avec les mêmes numéros de sommets)
+         */
+        RandomWalk(const ReachabilityGame &game, const CompactGame &compact);
+
+        /**
+         * \brief Génère une nouvelle marche de length pas (la marche précédente est oubliée). La marche s'arrête plus tôt si elle arrive sur un sommet sans successeur
+         * \param length Le nombre de pas
+         * \param generator Le générateur aléatoire
+         */
+        template<typename Generator>
+        void walk(std::size_t length, Generator &generator) {
+            start();
+            unsigned int current = m_compact.getInit();
+            for (std::size_t i = 0 ; i < length ; i++) {
+                const std::size_t degree = m_compact.getNumberSuccessors(current);
+                if (degree == 0) {
+                    break;
+                }
+                std::size_t edge = m_compact.beginEdges(current);
+                if (degree > 1) {
+                    edge += std::uniform_int_distribution<std::size_t>(0, degree - 1)(generator);
+                }
+                current = m_compact.getSuccessor(edge);
+                step(edge, current);
+            }
+        }
+
+        /**
+         * \brief Génère une nouvelle marche en vérifiant au fur et à mesure qu'elle peut encore être un équilibre de Nash.
+         * 
+         * Pour chaque joueur p qui n'a pas encore vu sa cible, on garde la borne min(val_p(v_i) + coût_i(p)) sur les sommets v_i de p déjà visités, où val_p est la valeur de coalition. La marche est un équilibre ssi le coût final de chaque joueur ne dépasse pas sa borne (c'est le test de Path::isANashEquilibrium).
+         * 
+         * Si les poids sont positifs, les coûts ne font qu'augmenter : la marche est abandonnée dès qu'un coût dépasse sa borne. Elle s'arrête aussi dès que tous les joueurs ont vu leur cible, puisque plus rien ne peut changer. Avec des poids négatifs, les bornes ne sont comparées qu'à la fin. La marche s'arrête aussi sur un sommet sans successeur.
+         * \param length Le nombre maximal de pas
+         * \param generator Le générateur aléatoire
+         * \return Vrai ssi la marche (éventuellement raccourcie) est un équilibre de Nash. Si faux, la marche a pu être abandonnée avant la fin
+         */
+        template<typename Generator>
+        bool walkEquilibrium(std::size_t length, Generator &generator) {
+            return walkEquilibriumWith(length, [this, &generator](unsigned int current) {
+                const std::size_t degree = m_compact.getNumberSuccessors(current);
+                std::size_t edge = m_compact.beginEdges(current);
+                if (degree > 1) {
+                    edge += std::uniform_int_distribution<std::size_t>(0, degree - 1)(generator);
+                }
+                return edge;
+            });
+        }
+
+        /**
+         * \brief Comme walkEquilibrium mais les successeurs sont tirés par sampler.
+         * 
+         * À chaque sommet, le joueur guidé est le propriétaire du sommet s'il n'a pas encore vu sa cible, sinon un joueur tiré uniformément parmi ceux qui ne l'ont pas encore vue.
+         * \param length Le nombre maximal de pas
+         * \param sampler Les tables de choix des successeurs (construites pour le même jeu)
+         * \param generator Le générateur aléatoire
+         * \return Vrai ssi la marche (éventuellement raccourcie) est un équilibre de Nash
+         */
+        template<typename Generator>
+        bool walkEquilibrium(std::size_t length, const GuidedSampler &sampler, Generator &generator) {
+            return walkEquilibriumWith(length, [this, &sampler, &generator](unsigned int current) {
+                unsigned int player = m_compact.getPlayer(current);
+                if (m_reached[player]) {
+                    // Le k-ième joueur qui n'a pas encore vu sa cible (il en reste au moins un)
+                    std::size_t k = std::uniform_int_distribution<std::size_t>(0, m_costs.size() - m_nReached - 1)(generator);
+                    for (player = 0 ; ; player++) {
+                        if (!m_reached[player] && k-- == 0) {
+                            break;
+                        }
+                    }
+                }
+                return sampler.choose(current, player, generator);
+            });
+        }
+
+        /**
+         * \brief Vérifie que la dernière marche est un équilibre de Nash (même test que Path::isANashEquilibrium)
+         * \return Vrai ssi la marche est un équilibre de Nash
+         */
+        bool isANashEquilibrium() const;
+
+        /**
+         * \return Le nombre de sommets de la marche (le nombre de pas plus un)
+         */
+        std::size_t size() const {
+            return m_vertices.size();
+        }
+
+        /**
+         * \return Les sommets de la marche, dans l'ordre
+         */
+        const std::vector<unsigned int>& getVertices() const {
+            return m_vertices;
+        }
+
+        /**
+         * \return Le coût actuel de chaque joueur
+         */
+        const std::vector<long>& getCosts() const {
+            return m_costs;
+        }
+
+        /**
+         * \brief Indique si un joueur a vu une de ses cibles
+         * \param player Le joueur
+         * \return Vrai ssi le joueur a vu une cible
+         */
+        bool hasReached(unsigned int player) const {
+            return m_reached[player];
+        }
+
+        /**
+         * \return Le nombre de joueurs qui ont vu une de leurs cibles
+         */
+        std::size_t getNumberReached() const {
+            return m_nReached;
+        }
+
+        /**
+         * \brief Construit le Path qui correspond à une suite de sommets
+         * \param vertices Les sommets, par exemple ceux de getVertices()
+         * \return Le chemin
+         */
+        Path toPath(const std::vector<unsigned int> &vertices) const;
+
+    private:
+        void start();
+
+        /**
+         * \brief Le corps de walkEquilibrium ; chooseEdge(v) donne l'arc à suivre depuis v
+         */
+        template<typename ChooseEdge>
+        bool walkEquilibriumWith(std::size_t length, ChooseEdge chooseEdge) {
+            start();
+            loadCoalitionValues();
+            std::fill(m_bounds.begin(), m_bounds.end(), std::numeric_limits<long>::max());
+
+            unsigned int current = m_compact.getInit();
+            if (!constrain(current)) {
+                return false;
+            }
+            for (std::size_t i = 0 ; i < length && m_nReached < m_costs.size() ; i++) {
+                if (m_compact.getNumberSuccessors(current) == 0) {
+                    break;
+                }
+                const std::size_t edge = chooseEdge(current);
+                current = m_compact.getSuccessor(edge);
+                if (!stepBounded(edge, current) && m_nonNegative) {
+                    return false;
+                }
+                if (!constrain(current)) {
+                    return false;
+                }
+            }
+
+            for (std::size_t p = 0 ; p < m_costs.size() ; p++) {
+                if (m_costs[p] > m_bounds[p]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void loadCoalitionValues() const;
+
+        /**
+         * \brief Ajoute un pas et indique si tous les coûts qui ont augmenté respectent encore leur borne
+         */
+        bool stepBounded(std::size_t edge, unsigned int to) {
+            m_vertices.push_back(to);
+            m_edges.push_back(edge);
+            const long* weights = m_compact.getWeights(edge);
+            bool respected = true;
+            for (std::size_t p = 0 ; p < m_costs.size() ; p++) {
+                if (!m_reached[p]) {
+                    m_costs[p] += weights[p];
+                    respected &= m_costs[p] <= m_bounds[p];
+                }
+            }
+            markTargets(to);
+            return respected;
+        }
+
+        /**
+         * \brief Met à jour la borne du propriétaire de v s'il n'a pas encore vu sa cible
+         * \return Faux si la valeur de coalition du propriétaire en v est -infini : comme pour Path::isANashEquilibrium, la marche ne peut alors plus être un équilibre
+         */
+        bool constrain(unsigned int v) {
+            const unsigned int owner = m_compact.getPlayer(v);
+            if (!m_reached[owner]) {
+                const types::Long &value = (*m_coalitionValues[owner])[v];
+                if (value.isInfinity()) {
+                    return value > 0;
+                }
+                m_bounds[owner] = std::min(m_bounds[owner], value.getValue() + m_costs[owner]);
+            }
+            return true;
+        }
+
+        void step(std::size_t edge, unsigned int to) {
+            m_vertices.push_back(to);
+            m_edges.push_back(edge);
+            const long* weights = m_compact.getWeights(edge);
+            for (std::size_t p = 0 ; p < m_costs.size() ; p++) {
+                if (!m_reached[p]) {
+                    m_costs[p] += weights[p];
+                }
+            }
+            markTargets(to);
+        }
+
+        void markTargets(unsigned int v) {
+            const std::uint64_t* targets = m_compact.getTargets() + v * m_targetWords;
+            for (std::size_t w = 0 ; w < m_targetWords ; w++) {
+                for (std::uint64_t bits = targets[w] ; bits != 0 ; bits &= bits - 1) {
+                    const std::size_t p = w * 64 + std::size_t(__builtin_ctzll(bits));
+                    if (!m_reached[p]) {
+                        m_reached[p] = true;
+                        m_nReached++;
+                    }
+                }
+            }
+        }
+
+    private:
+        const ReachabilityGame &m_game;
+        const CompactGame &m_compact;
+        const std::size_t m_targetWords;
+        mutable std::vector<const std::vector<types::Long>*> m_coalitionValues;
+
+        std::vector<unsigned int> m_vertices;
+        std::vector<std::size_t> m_edges;
+        std::vector<long> m_costs;
+        std::vector<char> m_reached;
+        std::size_t m_nReached;
+        std::vector<long> m_bounds;
+        bool m_nonNegative;
+    };
+}
\ No newline at end of file
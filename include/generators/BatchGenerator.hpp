@@ -0,0 +1,67 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "ReachabilityGame.hpp"
+
+namespace generators {
+    /**
+     * \brief La signature d'une fonction qui génère un jeu à partir d'un générateur de nombres aléatoires.
+     * 
+     * Typiquement, une lambda qui appelle un des générateurs avec ses paramètres et le générateur reçu.
+     */
+    typedef std::function<ReachabilityGame(std::default_random_engine &generator)> gameGeneratorSignature;
+
+    /**
+     * \brief Donne la graine du flux aléatoire numéro index pour la graine maîtresse donnée.
+     * 
+     * La graine est calculée directement à partir de (masterSeed, index) par un mélange de type SplitMix64 (générateur à compteur) : elle ne dépend pas des autres flux, ni de l'ordre dans lequel ils sont demandés.
+     * \param masterSeed La graine maîtresse
+     * \param index Le numéro du flux
+     * \return La graine du flux
+     */
+    std::uint64_t streamSeed(std::uint64_t masterSeed, std::uint64_t index);
+
+    /**
+     * \brief Construit le générateur de nombres aléatoires du flux numéro index.
+     * 
+     * Permet de régénérer seul le jeu numéro index d'un lot généré par batchGenerator.
+     * \param masterSeed La graine maîtresse
+     * \param index Le numéro du flux
+     * \return Le générateur
+     */
+    std::default_random_engine streamEngine(std::uint64_t masterSeed, std::uint64_t index);
+
+    /**
+     * \brief Génère nGames jeux en parallèle.
+     * 
+     * Le jeu i est généré avec streamEngine(masterSeed, i). Il est donc identique quel que soit le nombre de threads utilisés.
+     * \param nGames Le nombre de jeux à générer
+     * \param masterSeed La graine maîtresse
+     * \param generate La fonction qui génère un jeu
+     * \param nThreads Le nombre de threads. Si 0, on utilise le nombre de coeurs de la machine
+     * \return Les jeux, dans l'ordre de leur numéro
+     */
+    std::vector<ReachabilityGame> batchGenerator(std::size_t nGames, std::uint64_t masterSeed, const gameGeneratorSignature &generate, std::size_t nThreads = 0);
+}
\ No newline at end of file
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <random>
+
 #include "ReachabilityGame.hpp"
 
 namespace generators {
@@ -67,4 +69,12 @@ namespace generators {
      * \param maximumTargets Un tableau qui indique pour chaque joueur le nombre maximal de cibles qu'il peut avoir
      */
     ReachabilityGame randomStronglyConnectedGenerator(std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets);
+
+    /**
+     * \brief Identique à la fonction précédente mais les tirages aléatoires sont faits avec le générateur donné.
+     * 
+     * Deux appels avec des générateurs dans le même état produisent le même jeu.
+     * \param generator Le générateur de nombres aléatoires à utiliser
+     */
+    ReachabilityGame randomStronglyConnectedGenerator(std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets, std::default_random_engine &generator);
 }
\ No newline at end of file
@@ -0,0 +1,59 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <random>
+#include <vector>
+
+#include "CompactGame.hpp"
+#include "types/Long.hpp"
+
+namespace generators {
+    /**
+     * \brief Génère aléatoirement un jeu comme randomGenerator mais envoie directement les sommets et les arcs au récepteur, sans construire de Vertex.
+     * 
+     * Les arcs sont envoyés triés selon leur sommet de départ. La mémoire utilisée par le générateur est O(nombre de joueurs + nombre maximal d'arcs sortants) : un très grand jeu peut être écrit directement dans un fichier.
+     * 
+     * Les paramètres sont ceux de randomGenerator.
+     * \param sink Le récepteur du jeu
+     */
+    void streamRandomGenerator(GameSink &sink, std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets, std::default_random_engine &generator);
+
+    /**
+     * \brief Génère aléatoirement un jeu comme randomTreeLikeGenerator mais envoie directement les sommets et les arcs au récepteur.
+     * 
+     * Les sommets sont numérotés dans l'ordre d'un parcours en largeur de l'arbre : chaque profondeur est un intervalle d'IDs. Au lieu de tester chaque paire de sommets, le générateur tire pour chaque sommet le nombre d'arcs de chaque type (binomiale) puis les sommets d'arrivée. Le coût est donc O(V + E) au lieu de O(V²).
+     * 
+     * Les arcs sont envoyés triés selon leur sommet de départ. Le générateur garde O(V) entiers en mémoire (la structure de l'arbre).
+     * 
+     * Les paramètres sont ceux de randomTreeLikeGenerator.
+     * \param sink Le récepteur du jeu
+     */
+    void streamRandomTreeLikeGenerator(GameSink &sink, std::size_t size, std::size_t lowBranchingFactor, std::size_t upBranchingFactor, double probaSelf, double probaSameDepth, double probaSkipping, double probaClimbing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double> &probaTargets, const std::vector<types::Long>& maximumTargets, std::default_random_engine &generator);
+
+    /**
+     * \brief Génère aléatoirement un jeu sur graphe fortement connexe comme randomStronglyConnectedGenerator mais envoie le résultat au récepteur.
+     * 
+     * Le jeu de base est construit sous forme compacte (CompactGame), les composantes sont calculées par tarjanIterative et fusionnées sans relancer Tarjan. Les arcs sont envoyés triés selon leur sommet de départ.
+     * 
+     * Les paramètres sont ceux de randomStronglyConnectedGenerator.
+     * \param sink Le récepteur du jeu
+     */
+    void streamRandomStronglyConnectedGenerator(GameSink &sink, std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets, std::default_random_engine &generator);
+}
\ No newline at end of file
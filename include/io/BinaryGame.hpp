@@ -0,0 +1,132 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "CompactGame.hpp"
+
+/**
+ * \brief Lecture et écriture de jeux
+ */
+namespace io {
+    /**
+     * \brief L'en-tête d'un fichier de jeu binaire.
+     * 
+     * Le fichier contient, dans cet ordre : l'en-tête, les poids (int64, nEdges * nPlayers), les successeurs (uint32, nEdges), les débuts des listes d'arcs (uint64, nVertices + 1), les propriétaires (uint32, nVertices) et les cibles (uint64, nVertices * CompactGame::targetWords(nPlayers)). Chaque section commence à une position multiple de 8 donnée dans l'en-tête.
+     * 
+     * Les entiers sont écrits dans l'ordre natif de la machine ; le champ endianness permet de refuser un fichier écrit sur une machine d'un autre ordre.
+     */
+    struct BinaryGameHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t endianness;
+        std::uint64_t nVertices;
+        std::uint64_t nEdges;
+        std::uint64_t nPlayers;
+        std::uint64_t init;
+        std::uint64_t weightsPosition;
+        std::uint64_t successorsPosition;
+        std::uint64_t offsetsPosition;
+        std::uint64_t ownersPosition;
+        std::uint64_t targetsPosition;
+        std::uint64_t fileSize;
+        std::uint64_t reserved[4];
+    };
+
+    /**
+     * \brief La version actuelle du format binaire
+     */
+    const std::uint32_t binaryGameVersion = 1;
+
+    /**
+     * \brief Écrit un jeu dans un fichier binaire au fur et à mesure qu'il est reçu.
+     * 
+     * Les arcs doivent arriver triés selon leur sommet de départ. Les poids sont écrits directement dans le fichier et les successeurs dans un fichier temporaire recopié à la fin : la mémoire utilisée est O(V), quel que soit le nombre d'arcs.
+     * 
+     * Le fichier n'est valide qu'après l'appel à finish.
+     */
+    class BinaryGameWriter : public GameSink {
+    public:
+        /**
+         * \brief Prépare l'écriture
+         * \param path Le chemin du fichier à créer
+         */
+        explicit BinaryGameWriter(const std::string &path);
+        ~BinaryGameWriter();
+
+        BinaryGameWriter(const BinaryGameWriter&) = delete;
+        BinaryGameWriter& operator=(const BinaryGameWriter&) = delete;
+
+        void begin(std::size_t nVertices, std::size_t nPlayers, unsigned int init) override;
+        void setPlayer(unsigned int vertex, unsigned int player) override;
+        void addTarget(unsigned int vertex, unsigned int player) override;
+        void addEdge(unsigned int from, unsigned int to, const long* weights) override;
+        void finish() override;
+
+    private:
+        void close();
+
+        std::string m_path;
+        std::FILE* m_file;
+        std::FILE* m_successorsFile;
+        std::vector<char> m_buffer;
+        BinaryGameHeader m_header;
+        std::vector<std::uint64_t> m_offsets;
+        std::vector<std::uint32_t> m_owners;
+        std::vector<std::uint64_t> m_targets;
+        std::size_t m_lastFrom;
+    };
+
+    /**
+     * \brief Écrit un jeu compact dans un fichier binaire
+     * \param game Le jeu
+     * \param path Le chemin du fichier
+     */
+    void writeBinaryGame(const CompactGame &game, const std::string &path);
+
+    /**
+     * \brief Écrit un jeu dans un fichier binaire
+     * \param game Le jeu
+     * \param path Le chemin du fichier
+     */
+    void writeBinaryGame(const ReachabilityGame &game, const std::string &path);
+
+    /**
+     * \brief Charge un fichier binaire en le projetant en mémoire (mmap).
+     * 
+     * Le jeu renvoyé lit directement les pages du fichier : rien n'est copié. La projection est libérée quand la dernière copie du jeu est détruite.
+     * 
+     * L'en-tête est toujours vérifié (version, ordre des octets, tailles des sections). Si validate est vrai, le contenu est aussi vérifié en une passe O(V+E) : débuts des listes d'arcs croissants, successeurs et propriétaires existants. Cette passe lit les débuts des listes, les successeurs et les propriétaires, donc charge ces pages dès l'ouverture. Avec validate faux, seules les pages réellement lues par la suite sont chargées et l'ouverture ne prend que quelques millisecondes, mais un fichier abîmé peut faire lire hors des tableaux : à réserver aux fichiers de confiance.
+     * \param path Le chemin du fichier
+     * \param validate Si vrai, le contenu des sections est vérifié
+     * \return Le jeu
+     */
+    CompactGame loadBinaryGame(const std::string &path, bool validate = true);
+
+    /**
+     * \brief Charge un jeu depuis un fichier : binaire si l'extension est .rgb, textuel (DOT ou liste d'arcs) sinon
+     * \param path Le chemin du fichier
+     * \return Le jeu
+     */
+    CompactGame loadGame(const std::string &path);
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace io {
+    /**
+     * \brief Écrit dans un fichier, un descripteur, un FILE* ou un std::ostream en passant par un grand tampon.
+     * 
+     * Les entiers sont convertis à la main (sans iostreams ni printf). Le tampon est vidé quand il est plein, lors de l'appel à flush et à la destruction.
+     */
+    class BufferedWriter {
+    public:
+        /**
+         * \brief Crée (ou écrase) un fichier et écrit dedans
+         * \param path Le chemin du fichier
+         * \param bufferSize La taille du tampon
+         */
+        explicit BufferedWriter(const std::string &path, std::size_t bufferSize = 1 << 20);
+
+        /**
+         * \brief Écrit dans un descripteur de fichier (qui n'est pas fermé)
+         */
+        explicit BufferedWriter(int fd, std::size_t bufferSize = 1 << 20);
+
+        /**
+         * \brief Écrit dans un FILE* (qui n'est pas fermé)
+         */
+        explicit BufferedWriter(std::FILE* file, std::size_t bufferSize = 1 << 20);
+
+        /**
+         * \brief Écrit dans un flux
+         */
+        explicit BufferedWriter(std::ostream &stream, std::size_t bufferSize = 1 << 20);
+
+        ~BufferedWriter();
+
+        BufferedWriter(const BufferedWriter&) = delete;
+        BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+        void put(char c) {
+            if (m_used == m_buffer.size()) {
+                flushBuffer();
+            }
+            m_buffer[m_used++] = c;
+        }
+
+        void write(const char* data, std::size_t size);
+
+        void write(const std::string &text) {
+            write(text.data(), text.size());
+        }
+
+        void writeUnsigned(unsigned long value);
+
+        void writeLong(long value);
+
+        /**
+         * \brief Vide le tampon et le sink sous-jacent
+         */
+        void flush();
+
+    private:
+        enum class Kind { Descriptor, File, Stream };
+
+        void flushBuffer();
+        void writeDirect(const char* data, std::size_t size);
+
+        Kind m_kind;
+        int m_fd;
+        bool m_ownsDescriptor;
+        std::FILE* m_file;
+        std::ostream* m_stream;
+        std::vector<char> m_buffer;
+        std::size_t m_used;
+    };
+
+    inline BufferedWriter& operator<<(BufferedWriter &writer, const char* text) {
+        writer.write(text, std::char_traits<char>::length(text));
+        return writer;
+    }
+
+    inline BufferedWriter& operator<<(BufferedWriter &writer, const std::string &text) {
+        writer.write(text);
+        return writer;
+    }
+
+    inline BufferedWriter& operator<<(BufferedWriter &writer, char c) {
+        writer.put(c);
+        return writer;
+    }
+
+    inline BufferedWriter& operator<<(BufferedWriter &writer, long value) {
+        writer.writeLong(value);
+        return writer;
+    }
+
+    inline BufferedWriter& operator<<(BufferedWriter &writer, int value) {
+        writer.writeLong(value);
+        return writer;
+    }
+
+    inline BufferedWriter& operator<<(BufferedWriter &writer, unsigned long value) {
+        writer.writeUnsigned(value);
+        return writer;
+    }
+
+    inline BufferedWriter& operator<<(BufferedWriter &writer, unsigned int value) {
+        writer.writeUnsigned(value);
+        return writer;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "Path.hpp"
+#include "ReachabilityGame.hpp"
+#include "exploration/Engines.hpp"
+#include "types/Long.hpp"
+
+namespace io {
+    /**
+     * \brief Le résultat d'un moteur de résolution
+     */
+    struct SolveResult {
+        /** \brief ok, timeout, no_equilibrium, out_of_memory ou error */
+        std::string status;
+        /** \brief Le chemin et ses coûts en JSON (voir pathToJSON), vide en cas d'échec */
+        std::string details;
+        /** \brief Le message d'erreur, vide en cas de succès */
+        std::string message;
+    };
+
+    /**
+     * \brief Échappe une chaîne pour l'écrire entre guillemets dans du JSON
+     * \param text La chaîne
+     * \return La chaîne échappée
+     */
+    std::string escapeJSON(const std::string &text);
+
+    /**
+     * \brief Décrit un chemin en JSON : "path":[IDs des sommets],"costs":[{"reached":...,"cost":...}, ...]
+     * 
+     * Le texte renvoyé est une suite de membres d'un objet JSON (sans accolades) pour pouvoir être ajouté à un objet existant.
+     * \param path Le chemin
+     * \return Les membres JSON
+     */
+    std::string pathToJSON(const Path &path);
+
+    /**
+     * \brief Écrit une durée en millisecondes avec trois décimales
+     * \param duration La durée
+     * \return La durée en texte
+     */
+    std::string millisecondsToJSON(std::chrono::steady_clock::duration duration);
+
+    /**
+     * \brief Donne le temps qui reste avant une échéance, en secondes entières comme EngineOptions::allowedTime.
+     * 
+     * Le temps est arrondi à la seconde supérieure : un moteur qui reçoit ce temps peut dépasser l'échéance de moins d'une seconde, ce qui correspond à la précision de l'horloge des moteurs.
+     * \param deadline L'échéance
+     * \param now L'instant présent
+     * \return Le temps en secondes, 0 si l'échéance est passée
+     */
+    types::Long remainingSeconds(std::chrono::steady_clock::time_point deadline, std::chrono::steady_clock::time_point now);
+
+    /**
+     * \brief Exécute un moteur sur un jeu et classe le résultat.
+     * 
+     * Les exceptions des moteurs (temps écoulé, pas d'équilibre, mémoire insuffisante, ...) sont attrapées et traduites en statut.
+     * \param engine Le moteur
+     * \param game Le jeu
+     * \param options Les options du moteur
+     * \return Le résultat
+     */
+    SolveResult runEngine(const exploration::engineSignature &engine, ReachabilityGame &game, const exploration::EngineOptions &options);
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "CompactGame.hpp"
+#include "ReachabilityGame.hpp"
+#include "types/ThreadPool.hpp"
+
+namespace io {
+    /**
+     * \brief Un serveur qui résout des jeux à la demande, à travers un socket Unix.
+     * 
+     * Les jeux chargés restent en mémoire entre les requêtes, avec leurs valeurs de coalition et leurs tables de coûts : seule la première résolution d'un jeu les calcule.
+     * 
+     * Le protocole est textuel, une requête par ligne, et chaque requête reçoit une ligne JSON en réponse ({"ok":true,...} ou {"ok":false,"error":"..."}) :
+     *  - load <nom> <fichier> : charge un jeu depuis un fichier (binaire .rgb, DOT ou liste d'arcs)
+     *  - game <nom> <edgelist|dot> <taille> : charge un jeu dont le texte (taille octets) suit immédiatement la ligne
+     *  - warm <nom> : calcule à l'avance les valeurs de coalition et les coûts du jeu
+     *  - solve <nom> <moteur> [time=<s>] [paths=<n>] [threads=<n>] [beam=<n>] [ties=<règle>] [symmetries=<0|1>] : résout le jeu (threads est le nombre de threads des moteurs parallèles, beam la largeur du faisceau, ties le départage des noeuds de même coût : depth, reached ou h, symmetries confond les états symétriques). Le temps permis compte à partir de la réception de la requête, attente comprise
+     *  - unload <nom> : oublie le jeu
+     *  - list : donne les jeux chargés
+     *  - quit : ferme la connexion
+     *  - shutdown : arrête le serveur
+     * 
+     * Chaque connexion est lue par son propre thread ; les résolutions sont exécutées par un ensemble de threads partagé par toutes les connexions.
+     */
+    class SolverDaemon {
+    public:
+        /**
+         * \brief Crée le socket et commence à écouter
+         * \param socketPath Le chemin du socket. Un fichier existant à cet endroit est remplacé
+         * \param nThreads Le nombre de résolutions simultanées. Si 0, on utilise le nombre de coeurs de la machine
+         */
+        explicit SolverDaemon(const std::string &socketPath, std::size_t nThreads = 0);
+        ~SolverDaemon();
+
+        SolverDaemon(const SolverDaemon&) = delete;
+        SolverDaemon& operator=(const SolverDaemon&) = delete;
+
+        /**
+         * \brief Accepte les connexions jusqu'à une requête shutdown ou un appel à stop
+         */
+        void run();
+
+        /**
+         * \brief Arrête le serveur. Les connexions ouvertes sont fermées
+         */
+        void stop();
+
+        /**
+         * \brief Exécute une requête (sans charge utile)
+         * \param request La ligne de la requête
+         * \return La ligne JSON de la réponse (sans retour à la ligne)
+         */
+        std::string handle(const std::string &request);
+
+    private:
+        class Connection;
+
+        void serve(int client);
+        std::string handle(const std::string &request, Connection *connection);
+        std::string addGame(const std::string &name, const CompactGame &compact);
+        std::shared_ptr<ReachabilityGame> findGame(const std::string &name);
+
+    private:
+        std::string m_socketPath;
+        int m_listener;
+        std::atomic<bool> m_stopped;
+        types::ThreadPool m_pool;
+
+        std::mutex m_gamesMutex;
+        std::map<std::string, std::shared_ptr<ReachabilityGame>> m_games;
+
+        std::mutex m_clientsMutex;
+        std::vector<std::pair<std::thread, std::shared_ptr<std::atomic<bool>>>> m_clients;
+        std::unordered_set<int> m_clientSockets;
+    };
+}
\ No newline at end of file
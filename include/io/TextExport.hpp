@@ -0,0 +1,79 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "CompactGame.hpp"
+#include "io/BufferedWriter.hpp"
+
+namespace io {
+    /**
+     * \brief Écrit le jeu au format DOT, pour un nombre quelconque de joueurs.
+     * 
+     * Chaque joueur a sa forme (circle, square, diamond, ...) pour ses sommets et sa couleur pour ses cibles. Un sommet qui est une cible de plusieurs joueurs a la couleur du premier et une double bordure. Le joueur, les cibles et le sommet initial sont aussi donnés par les attributs player, targets et init, et le nombre de joueurs par l'attribut players du graphe : parseDOT relit le fichier sans perte.
+     * \param game Le jeu
+     * \param writer Où écrire
+     */
+    void writeDOT(const CompactGame &game, BufferedWriter &writer);
+
+    /**
+     * \brief Écrit le jeu au format DOT (voir la fonction précédente)
+     * \param game Le jeu
+     * \param writer Où écrire
+     */
+    void writeDOT(const ReachabilityGame &game, BufferedWriter &writer);
+
+    /**
+     * \brief Écrit le jeu au format "liste d'arcs" lu par parseEdgeList.
+     * 
+     * Les sommets qui appartiennent au joueur 0 et ne sont des cibles pour personne n'ont pas de ligne v.
+     * \param game Le jeu
+     * \param writer Où écrire
+     */
+    void writeEdgeList(const CompactGame &game, BufferedWriter &writer);
+
+    /**
+     * \brief Écrit le jeu au format "liste d'arcs" lu par parseEdgeList
+     * \param game Le jeu
+     * \param writer Où écrire
+     */
+    void writeEdgeList(const ReachabilityGame &game, BufferedWriter &writer);
+
+    /**
+     * \brief Un récepteur qui écrit le jeu au format "liste d'arcs" au fur et à mesure qu'il le reçoit.
+     * 
+     * Les arcs peuvent arriver dans n'importe quel ordre. Seuls les propriétaires des sommets sont gardés en mémoire.
+     */
+    class EdgeListWriter : public GameSink {
+    public:
+        explicit EdgeListWriter(BufferedWriter &writer);
+
+        void begin(std::size_t nVertices, std::size_t nPlayers, unsigned int init) override;
+        void setPlayer(unsigned int vertex, unsigned int player) override;
+        void addTarget(unsigned int vertex, unsigned int player) override;
+        void addEdge(unsigned int from, unsigned int to, const long* weights) override;
+        void finish() override;
+
+    private:
+        BufferedWriter &m_writer;
+        std::size_t m_nPlayers;
+        std::vector<unsigned int> m_owners;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "CompactGame.hpp"
+
+namespace io {
+    /**
+     * \brief Lit un jeu au format "liste d'arcs" et l'envoie au récepteur.
+     * 
+     * Le format est orienté ligne. Les lignes vides et ce qui suit un # sont ignorés.
+     * \code
+     * game <nombre de sommets> <nombre de joueurs> <sommet initial>
+     * v <sommet> <joueur> [<joueur pour qui le sommet est une cible> ...]
+     * e <départ> <arrivée> <poids du joueur 0> ... <poids du joueur n-1>
+     * \endcode
+     * 
+     * La ligne game doit précéder toutes les autres. Un sommet sans ligne v appartient au joueur 0 et n'est une cible pour personne. Une ligne e peut ne donner qu'un seul poids, qui est alors utilisé pour tous les joueurs. Chaque sommet doit avoir au moins un arc sortant (une cible sans issue prend une boucle e v v 0).
+     * 
+     * Le fichier est lu par blocs de 1 Mo et les arcs sont envoyés dans l'ordre du fichier, en une seule passe.
+     * \param fd Le descripteur de fichier à lire (il n'est pas fermé)
+     * \param sink Le récepteur
+     */
+    void parseEdgeList(int fd, GameSink &sink);
+
+    /**
+     * \brief Lit un jeu au format "liste d'arcs" depuis la mémoire et l'envoie au récepteur
+     * \param data Le texte
+     * \param size La taille du texte
+     * \param sink Le récepteur
+     */
+    void parseEdgeList(const char* data, std::size_t size, GameSink &sink);
+
+    /**
+     * \brief Lit un fichier au format "liste d'arcs" et l'envoie au récepteur.
+     * \param path Le chemin du fichier
+     * \param sink Le récepteur
+     */
+    void parseEdgeList(const std::string &path, GameSink &sink);
+
+    /**
+     * \brief Charge un fichier au format "liste d'arcs"
+     * \param path Le chemin du fichier
+     * \return Le jeu
+     */
+    CompactGame loadEdgeList(const std::string &path);
+
+    /**
+     * \brief Lit un jeu au format DOT et l'envoie au récepteur.
+     * 
+     * Seul un sous-ensemble de DOT est reconnu : un digraph contenant des déclarations de sommets et d'arcs (éventuellement en chaîne a -> b -> c) avec leurs attributs. Les sous-graphes ne sont pas supportés.
+     * 
+     * Attributs des sommets :
+     *  - player=i : le joueur qui possède le sommet. Sinon, shape=square donne le joueur 1 et toute autre forme le joueur 0 (comme ReachabilityGame::printDOT) ;
+     *  - targets="i,j,..." : les joueurs pour qui le sommet est une cible. Sinon, color=red en fait une cible du joueur 0 et style=dotted une cible du joueur 1 (comme ReachabilityGame::printDOT) ;
+     *  - init=true : le sommet initial (le sommet 0 par défaut).
+     * 
+     * Attributs des arcs : weights="w0,w1,..." ou, à défaut, les entiers du label (par exemple label="(1, 2)"). Un seul poids est utilisé pour tous les joueurs.
+     * 
+     * Le nombre de joueurs est donné par l'attribut players=n du graphe ou, à défaut, déduit des joueurs, des cibles et du nombre de poids rencontrés.
+     * 
+     * Si tous les sommets sont nommés par un entier (éventuellement précédé de lettres, comme v12), cet entier est leur ID. Sinon, les IDs sont donnés dans l'ordre d'apparition.
+     * 
+     * Chaque sommet doit avoir au moins un arc sortant et, si les IDs sont numériques, chaque ID entre 0 et le plus grand doit être déclaré.
+     * \param fd Le descripteur de fichier à lire (il n'est pas fermé)
+     * \param sink Le récepteur
+     */
+    void parseDOT(int fd, GameSink &sink);
+
+    /**
+     * \brief Lit un jeu au format DOT depuis la mémoire et l'envoie au récepteur
+     * \param data Le texte
+     * \param size La taille du texte
+     * \param sink Le récepteur
+     */
+    void parseDOT(const char* data, std::size_t size, GameSink &sink);
+
+    /**
+     * \brief Lit un fichier au format DOT et l'envoie au récepteur.
+     * \param path Le chemin du fichier
+     * \param sink Le récepteur
+     */
+    void parseDOT(const std::string &path, GameSink &sink);
+
+    /**
+     * \brief Charge un fichier au format DOT
+     * \param path Le chemin du fichier
+     * \return Le jeu
+     */
+    CompactGame loadDOT(const std::string &path);
+
+    /**
+     * \brief Charge un jeu textuel en reconnaissant son format (DOT s'il commence par digraph ou strict, liste d'arcs sinon)
+     * \param path Le chemin du fichier
+     * \return Le jeu
+     */
+    CompactGame loadTextGame(const std::string &path);
+}
\ No newline at end of file
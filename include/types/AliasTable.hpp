@@ -0,0 +1,54 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <random>
+
+namespace types {
+    /**
+     * \brief Méthode des alias (Vose) : tire un indice selon une distribution discrète en O(1).
+     * 
+     * Une table de n entrées est faite de deux tableaux : probabilities[i] (la probabilité de garder i) et aliases[i] (l'indice renvoyé sinon). Les tableaux appartiennent à l'appelant, ce qui permet de ranger beaucoup de tables dans un même bloc de mémoire.
+     */
+    namespace aliasTable {
+        /**
+         * \brief Construit une table en O(n)
+         * \param weights Les poids (positifs ou nuls, pas tous nuls) des n indices
+         * \param n Le nombre d'indices
+         * \param probabilities Où écrire les probabilités (n entrées)
+         * \param aliases Où écrire les alias (n entrées)
+         */
+        void build(const double* weights, std::size_t n, float* probabilities, unsigned int* aliases);
+
+        /**
+         * \brief Tire un indice
+         * \param probabilities Les probabilités de la table
+         * \param aliases Les alias de la table
+         * \param n Le nombre d'indices
+         * \param generator Le générateur aléatoire
+         * \return Un indice dans [0, n)
+         */
+        template<typename Generator>
+        std::size_t draw(const float* probabilities, const unsigned int* aliases, std::size_t n, Generator &generator) {
+            const std::size_t i = std::uniform_int_distribution<std::size_t>(0, n - 1)(generator);
+            return std::uniform_real_distribution<float>(0.f, 1.f)(generator) < probabilities[i] ? i : aliases[i];
+        }
+    }
+}
\ No newline at end of file
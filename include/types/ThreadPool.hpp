@@ -0,0 +1,141 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <atomic>
+
+namespace types {
+    /**
+     * \brief Un ensemble de threads qui exécutent les tâches qu'on leur soumet.
+     * 
+     * Les threads sont créés une seule fois, à la construction, et sont arrêtés à la destruction (après avoir terminé les tâches en attente).
+     */
+    class ThreadPool {
+    public:
+        /**
+         * \brief Construit l'ensemble de threads
+         * \param nThreads Le nombre de threads. Si 0, on utilise le nombre de coeurs de la machine
+         */
+        explicit ThreadPool(std::size_t nThreads = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * \brief Donne le nombre de threads
+         * \return Le nombre de threads
+         */
+        std::size_t size() const;
+
+        /**
+         * \brief Soumet une tâche.
+         * 
+         * Si la tâche lance une exception, elle est relancée par std::future::get.
+         * \param task La tâche
+         * \return Le futur qui contiendra le résultat de la tâche
+         */
+        template<typename F>
+        std::future<typename std::result_of<F()>::type> submit(F task) {
+            typedef typename std::result_of<F()>::type Result;
+            auto packaged = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+            std::future<Result> future = packaged->get_future();
+            push([packaged]() { (*packaged)(); });
+            return future;
+        }
+
+        /**
+         * \brief Donne le nombre de coeurs de la machine (au moins 1)
+         * \return Le nombre de coeurs
+         */
+        static std::size_t defaultSize();
+
+    private:
+        void push(std::function<void()> task);
+        void work();
+
+    private:
+        std::vector<std::thread> m_threads;
+        std::queue<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stop;
+    };
+
+    /**
+     * \brief Exécute f(i, t) pour chaque i dans [0, n) en répartissant les indices sur les threads de pool.
+     * 
+     * t est le numéro (dans [0, pool.size())) de la tâche qui traite i : deux appels avec le même t ne sont jamais exécutés en même temps, ce qui permet d'avoir des données par thread.
+     * 
+     * La fonction attend que tous les indices soient traités. Si un appel lance une exception, les indices pas encore commencés sont abandonnés et, une fois toutes les tâches finies, la première exception est relancée ici.
+     * \param pool Les threads à utiliser
+     * \param n Le nombre d'indices
+     * \param f La fonction à appeler
+     */
+    template<typename F>
+    void parallelFor(ThreadPool &pool, std::size_t n, F f) {
+        std::size_t nTasks = std::min(pool.size(), n);
+        auto next = std::make_shared<std::atomic<std::size_t>>(0);
+        std::vector<std::future<void>> futures;
+        futures.reserve(nTasks);
+
+        for (std::size_t t = 0 ; t < nTasks ; t++) {
+            futures.push_back(pool.submit([next, n, t, &f]() {
+                try {
+                    for (std::size_t i = (*next)++ ; i < n ; i = (*next)++) {
+                        f(i, t);
+                    }
+                }
+                catch (...) {
+                    // Les autres tâches s'arrêtent au prochain indice
+                    *next = n;
+                    throw;
+                }
+            }));
+        }
+
+        // Toutes les tâches doivent être finies avant de relancer une exception : elles utilisent f, qui appartient à cet appel
+        for (auto &future : futures) {
+            future.wait();
+        }
+        for (auto &future : futures) {
+            future.get();
+        }
+    }
+
+    /**
+     * \brief Comme parallelFor(ThreadPool&, std::size_t, F) mais avec un ensemble de threads temporaire
+     * \param nThreads Le nombre de threads. Si 0, on utilise le nombre de coeurs de la machine
+     * \param n Le nombre d'indices
+     * \param f La fonction à appeler
+     */
+    template<typename F>
+    void parallelFor(std::size_t nThreads, std::size_t n, F f) {
+        ThreadPool pool(nThreads);
+        parallelFor(pool, n, f);
+    }
+}
\ No newline at end of file
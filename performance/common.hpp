@@ -26,9 +26,9 @@
 
 #include "generators/RandomTreeLikeGenerator.hpp"
 #include "exploration/BestFirstSearch.hpp"
+#include "exploration/Heuristics.hpp"
 
 using namespace types;
-using namespace std::placeholders;
 
 double clock_tToMilliSeconds(std::clock_t value) {
     return 1000. * value/CLOCKS_PER_SEC;
@@ -37,7 +37,7 @@ double clock_tToMilliSeconds(std::clock_t value) {
 std::clock_t execute(ReachabilityGame &game) {
     std::clock_t start = std::clock();
 
-    exploration::bestFirstSearch(game, std::bind(&ReachabilityGame::AStartPositive, &game, _1, _2), 10);
+    exploration::bestFirstSearch(game, exploration::heuristics::AStarPositive(game), 10);
 
     std::clock_t end = std::clock();
 
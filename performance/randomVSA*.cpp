@@ -20,11 +20,10 @@
 
 #include "ReachabilityGame.hpp"
 #include "exploration/BestFirstSearch.hpp"
+#include "exploration/Heuristics.hpp"
 #include "exploration/RandomPaths.hpp"
 #include "generators/RandomGenerator.hpp"
 
-using namespace std::placeholders;
-
 int main() {
     std::ofstream res("../plots/randomVSBestFirstSearch.data");
     std::size_t nGenerations = 100;
@@ -41,7 +40,7 @@ int main() {
             std::size_t nReachedBest = 0;
             types::Long costBest = 0;
             try {
-                Path best = exploration::bestFirstSearch(game, std::bind(&ReachabilityGame::AStartPositive, &game, _1, _2), 10);
+                Path best = exploration::bestFirstSearch(game, exploration::heuristics::AStarPositive(game), 10);
 
                 for (const auto& cost : best.getCosts()) {
                     if (cost.first) {
@@ -23,6 +23,7 @@
 #include <iterator>
 
 #include "generators/RandomTreeLikeGenerator.hpp"
+#include "generators/BatchGenerator.hpp"
 #include "exploration/BestFirstSearch.hpp"
 
 #include "common.hpp"
@@ -33,6 +34,7 @@ using namespace std::placeholders;
 int main()
 {
     std::size_t nGenerations = 1000;
+    std::uint64_t masterSeed = 2018; // Les jeux générés ne dépendent que de cette graine
     std::ofstream tree("../plots/treePlayersSize.data", std::ios_base::app);
 
     std::size_t size = 20;
@@ -49,7 +51,7 @@ int main()
     double probaSkipping = 0.5;
     double probaClimbing = 0.5;
 
-    tree << std::boolalpha << "# size=" << size << "; branchingFactor in [" << lowBranchingFactor << ", " << upBranchingFactor << "]; probaSelf=" << probaSelf << "; probaSameDetph=" << probaSameDepth << "; probaSkipping=" << probaSkipping << "; probaClimbing=" << probaClimbing << "; weights in [" << minWeight << ", " << maxWeight << "]; mutlipleWeight=" << multipleWeights << "; nPlayers=" << nPlayers << "; sharedTargets=" << sharedTargets << "; probaPlayers=1/nPlayers; probaTargets=0.1; maximumTargets=infinity;\n";
+    tree << std::boolalpha << "# size=" << size << "; branchingFactor in [" << lowBranchingFactor << ", " << upBranchingFactor << "]; probaSelf=" << probaSelf << "; probaSameDetph=" << probaSameDepth << "; probaSkipping=" << probaSkipping << "; probaClimbing=" << probaClimbing << "; weights in [" << minWeight << ", " << maxWeight << "]; mutlipleWeight=" << multipleWeights << "; nPlayers=" << nPlayers << "; sharedTargets=" << sharedTargets << "; probaPlayers=1/nPlayers; probaTargets=0.1; maximumTargets=infinity; masterSeed=" << masterSeed << ";\n";
 
     for (nPlayers = 8 ; nPlayers <= 8 ; nPlayers++) {
         for (size = 18 ; size <= 30 ; size++) {
@@ -60,9 +62,14 @@ int main()
             std::vector<std::clock_t> timesTree(nGenerations, 0);
             std::size_t nTimeOut = 0;
 
+            // On génère tous les jeux de cette configuration en parallèle
+            std::vector<ReachabilityGame> games = generators::batchGenerator(nGenerations, masterSeed, [&](std::default_random_engine &generator) {
+                return generators::randomTreeLikeGenerator(size, lowBranchingFactor, upBranchingFactor, probaSelf, probaSameDepth, probaSkipping, probaClimbing, minWeight, maxWeight, multipleWeights, nPlayers, sharedTargets, probaPlayers, probaTargets, maximumTargets, generator);
+            });
+
             for (std::size_t i = 0 ; i < nGenerations ; i++) {
                 std::cout << "GENERATION " << i << '\n';
-                ReachabilityGame game = generators::randomTreeLikeGenerator(size, lowBranchingFactor, upBranchingFactor, probaSelf, probaSameDepth, probaSkipping, probaClimbing, minWeight, maxWeight, multipleWeights, nPlayers, sharedTargets, probaPlayers, probaTargets, maximumTargets);
+                ReachabilityGame &game = games[i];
             
                 try {
                     timesTree[i] = execute(game);
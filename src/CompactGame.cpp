@@ -0,0 +1,206 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "CompactGame.hpp"
+
+#include <stdexcept>
+
+using namespace types;
+
+/**
+ * \brief Les tableaux d'un jeu construit en mémoire
+ */
+struct CompactGameBuilder::Storage {
+    std::size_t nVertices = 0;
+    std::size_t nPlayers = 0;
+    unsigned int init = 0;
+    std::vector<std::size_t> offsets;
+    std::vector<unsigned int> successors;
+    std::vector<long> weights;
+    std::vector<unsigned int> owners;
+    std::vector<std::uint64_t> targets;
+};
+
+CompactGame::CompactGame(std::size_t nVertices, std::size_t nEdges, std::size_t nPlayers, unsigned int init, const std::size_t* offsets, const unsigned int* successors, const long* weights, const unsigned int* owners, const std::uint64_t* targets, std::shared_ptr<const void> storage) :
+    m_nVertices(nVertices),
+    m_nEdges(nEdges),
+    m_nPlayers(nPlayers),
+    m_targetWords(targetWords(nPlayers)),
+    m_init(init),
+    m_offsets(offsets),
+    m_successors(successors),
+    m_weights(weights),
+    m_owners(owners),
+    m_targets(targets),
+    m_storage(storage)
+    {
+}
+
+CompactGame CompactGame::fromReachabilityGame(const ReachabilityGame &game) {
+    const Graph &graph = game.getGraph();
+    const std::vector<Player> &players = game.getPlayers();
+
+    CompactGameBuilder builder;
+    builder.begin(graph.size(), players.size(), game.getInit()->getID());
+
+    for (std::size_t i = 0 ; i < players.size() ; i++) {
+        // Les cibles de référence sont celles des joueurs (ce sont elles qu'utilisent les algorithmes)
+        for (const Vertex::Ptr &goal : players[i].getGoals()) {
+            builder.addTarget(goal->getID(), i);
+        }
+    }
+
+    std::vector<long> weights(players.size());
+    for (const Vertex::Ptr &v : graph.getVertices()) {
+        builder.setPlayer(v->getID(), v->getPlayer());
+
+        for (auto itr = v->cbegin() ; itr != v->cend() ; ++itr) {
+            const std::vector<Long> &w = itr->second.second;
+            for (std::size_t i = 0 ; i < weights.size() ; i++) {
+                weights[i] = w[i].getValue();
+            }
+            builder.addEdge(v->getID(), itr->first, weights.data());
+        }
+    }
+
+    builder.finish();
+    return builder.getGame();
+}
+
+ReachabilityGame CompactGame::toReachabilityGame() const {
+    std::vector<Vertex::Ptr> vertices(m_nVertices);
+    std::vector<Player> players;
+    players.reserve(m_nPlayers);
+    for (std::size_t i = 0 ; i < m_nPlayers ; i++) {
+        players.emplace_back(i);
+    }
+
+    for (std::size_t v = 0 ; v < m_nVertices ; v++) {
+        vertices[v] = std::make_shared<Vertex>(v, m_owners[v], m_nPlayers);
+        players[m_owners[v]].addVertex(vertices[v]);
+
+        for (std::size_t i = 0 ; i < m_nPlayers ; i++) {
+            if (isTargetFor(v, i)) {
+                vertices[v]->addTargetFor(i);
+                players[i].addGoal(vertices[v]);
+            }
+        }
+    }
+
+    for (std::size_t v = 0 ; v < m_nVertices ; v++) {
+        for (std::size_t e = beginEdges(v) ; e < endEdges(v) ; e++) {
+            const long* w = getWeights(e);
+            vertices[v]->addSuccessor(vertices[m_successors[e]], std::vector<Long>(w, w + m_nPlayers));
+        }
+    }
+
+    Graph graph(vertices, m_nPlayers);
+    return ReachabilityGame(graph, vertices[m_init], players);
+}
+
+CompactGameBuilder::CompactGameBuilder() :
+    m_sorted(true),
+    m_finished(false)
+    {
+}
+
+void CompactGameBuilder::begin(std::size_t nVertices, std::size_t nPlayers, unsigned int init) {
+    if (init >= nVertices) {
+        throw std::runtime_error("CompactGameBuilder: le sommet initial doit exister");
+    }
+    if (nPlayers == 0) {
+        throw std::runtime_error("CompactGameBuilder: il faut au moins un joueur");
+    }
+
+    m_storage = std::make_shared<Storage>();
+    m_storage->nVertices = nVertices;
+    m_storage->nPlayers = nPlayers;
+    m_storage->init = init;
+    m_storage->owners.assign(nVertices, 0);
+    m_storage->targets.assign(nVertices * CompactGame::targetWords(nPlayers), 0);
+    m_sources.clear();
+    m_sorted = true;
+    m_finished = false;
+}
+
+void CompactGameBuilder::setPlayer(unsigned int vertex, unsigned int player) {
+    if (vertex >= m_storage->nVertices || player >= m_storage->nPlayers) {
+        throw std::runtime_error("CompactGameBuilder: sommet ou joueur inconnu");
+    }
+    m_storage->owners[vertex] = player;
+}
+
+void CompactGameBuilder::addTarget(unsigned int vertex, unsigned int player) {
+    if (vertex >= m_storage->nVertices || player >= m_storage->nPlayers) {
+        throw std::runtime_error("CompactGameBuilder: sommet ou joueur inconnu");
+    }
+    m_storage->targets[vertex * CompactGame::targetWords(m_storage->nPlayers) + player / 64] |= std::uint64_t(1) << (player % 64);
+}
+
+void CompactGameBuilder::addEdge(unsigned int from, unsigned int to, const long* weights) {
+    if (from >= m_storage->nVertices || to >= m_storage->nVertices) {
+        throw std::runtime_error("CompactGameBuilder: un arc doit relier deux sommets existants");
+    }
+    if (!m_sources.empty() && from < m_sources.back()) {
+        m_sorted = false;
+    }
+    m_sources.push_back(from);
+    m_storage->successors.push_back(to);
+    m_storage->weights.insert(m_storage->weights.end(), weights, weights + m_storage->nPlayers);
+}
+
+void CompactGameBuilder::finish() {
+    Storage &s = *m_storage;
+    const std::size_t nEdges = m_sources.size();
+
+    // On compte les arcs sortants de chaque sommet
+    s.offsets.assign(s.nVertices + 1, 0);
+    for (unsigned int from : m_sources) {
+        s.offsets[from + 1]++;
+    }
+    for (std::size_t v = 0 ; v < s.nVertices ; v++) {
+        s.offsets[v + 1] += s.offsets[v];
+    }
+
+    if (!m_sorted) {
+        // Tri par dénombrement : chaque arc est placé directement à sa position finale
+        std::vector<std::size_t> next(s.offsets.begin(), s.offsets.end() - 1);
+        std::vector<unsigned int> successors(nEdges);
+        std::vector<long> weights(nEdges * s.nPlayers);
+        for (std::size_t e = 0 ; e < nEdges ; e++) {
+            std::size_t position = next[m_sources[e]]++;
+            successors[position] = s.successors[e];
+            std::copy(s.weights.begin() + e * s.nPlayers, s.weights.begin() + (e + 1) * s.nPlayers, weights.begin() + position * s.nPlayers);
+        }
+        s.successors.swap(successors);
+        s.weights.swap(weights);
+    }
+
+    s.successors.shrink_to_fit();
+    s.weights.shrink_to_fit();
+    std::vector<unsigned int>().swap(m_sources);
+    m_finished = true;
+}
+
+CompactGame CompactGameBuilder::getGame() const {
+    if (!m_finished) {
+        throw std::runtime_error("CompactGameBuilder: finish doit être appelé avant getGame");
+    }
+    const Storage &s = *m_storage;
+    return CompactGame(s.nVertices, s.successors.size(), s.nPlayers, s.init, s.offsets.data(), s.successors.data(), s.weights.data(), s.owners.data(), s.targets.data(), m_storage);
+}
\ No newline at end of file
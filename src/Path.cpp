@@ -84,7 +84,6 @@ bool Path::isANashEquilibrium(std::unordered_set<unsigned int> playersAlreadyTes
 
     // unordered_...::find ont une complexité de O(1) en moyenne
     std::unordered_set<unsigned int> visitedPlayers; // Ensemble des joueurs ayant déjà atteint une de leurs cibles
-    std::unordered_map<unsigned int, std::vector<Long>> coalitions; // A un joueur, on associe les valeurs de la coalition contre lui
 
     for (auto itr = m_path.begin() ; nash && itr != m_path.end() ; ++itr) {
         const std::shared_ptr<const Vertex> current = *itr;
@@ -107,21 +106,8 @@ bool Path::isANashEquilibrium(std::unordered_set<unsigned int> playersAlreadyTes
         if (playersAlreadyTested.find(player) == playersAlreadyTested.end() && visitedPlayers.find(player) == visitedPlayers.end()) {
             //  Si le joueur actuel n'a pas déjà atteint une cible (et qu'il n'a pas déjà été testé), on vérifie si c'est bien un EN
 
-            Long val(0);
-            
-            if (coalitions.find(player) == coalitions.end()) {
-                // On ne connait pas encore les valeurs
-                MinMaxGame minmax = MinMaxGame::convert(m_game, player);
-
-                std::vector<Long> values = minmax.getValues(m_game.getPlayers()[player].getGoals());
-                coalitions[player] = values;
-
-                val = values[current->getID()];
-            }
-            else {
-                // On connait déjà les valeurs
-                val = coalitions[player][current->getID()];
-            }
+            // Les valeurs de la coalition sont calculées une seule fois par jeu
+            Long val = m_game.getCoalitionValues(player)[current->getID()];
 
             if (!respectProperty(val, epsilon, player)) {
                 nash = false;
@@ -140,6 +126,10 @@ const std::shared_ptr<const Vertex> Path::getLast() const {
     return m_path.back();
 }
 
+const std::list<std::shared_ptr<const Vertex>>& Path::getSteps() const {
+    return m_path;
+}
+
 bool Path::respectProperty(const Long &val, const std::vector<Long>& epsilon, unsigned int player) const {
     return val + epsilon[player] >= m_costs[player].second;
 }
@@ -18,16 +18,52 @@
 
 #include "ReachabilityGame.hpp"
 
+#include <atomic>
 #include <iostream>
+#include <mutex>
 #include <queue>
 
+#include "CompactGame.hpp"
+#include "algorithms/CondensedMinMax.hpp"
+#include "algorithms/MinMaxValues.hpp"
+#include "algorithms/Symmetries.hpp"
+#include "exploration/BestFirstSearch.hpp"
+#include "exploration/ForcedChains.hpp"
+#include "exploration/Heuristics.hpp"
+
 using namespace types;
 using namespace exploration;
 
+/**
+ * \brief Les valeurs calculées à la demande et gardées entre les appels
+ */
+struct ReachabilityGame::Cache {
+    explicit Cache(std::size_t nPlayers) :
+        coalitionFlags(nPlayers),
+        coalitionValues(nPlayers)
+        {
+    }
+
+    std::vector<std::once_flag> coalitionFlags;
+    std::vector<std::vector<Long>> coalitionValues;
+    std::atomic<std::size_t> coalitionThreads{1};
+    std::once_flag condensedFlag;
+    std::unique_ptr<algorithms::CondensedMinMax> condensed;
+    std::once_flag costsFlag;
+    CostsMap costs;
+    std::once_flag distancesFlag;
+    std::vector<Long> distances;
+    std::once_flag symmetriesFlag;
+    std::unique_ptr<algorithms::Symmetries> symmetries;
+    std::once_flag forcedChainsFlag;
+    std::unique_ptr<exploration::ForcedChains> forcedChains;
+};
+
 ReachabilityGame::ReachabilityGame(Graph graph, Vertex::Ptr init, const std::vector<Player>& players) :
     Game(graph, init),
     m_players(players),
-    m_maxWeightsPath(players.size())
+    m_maxWeightsPath(players.size()),
+    m_cache(std::make_shared<Cache>(players.size()))
     {
     for (std::size_t i = 0 ; i < players.size() ; i++) {
         // Le poids maximal pour un chemin est (|Pi| + 1) * |V| * max(|w_i|)
@@ -39,6 +75,23 @@ const std::vector<Player> &ReachabilityGame::getPlayers() const {
     return m_players;
 }
 
+bool ReachabilityGame::hasNonNegativeWeights() const {
+    for (const Vertex::Ptr &vertex : getGraph().getVertices()) {
+        for (auto succ = vertex->cbegin() ; succ != vertex->cend() ; ++succ) {
+            for (const Long &w : succ->second.second) {
+                if (w < 0) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+const std::vector<Long>& ReachabilityGame::getMaxWeightsPath() const {
+    return m_maxWeightsPath;
+}
+
 std::size_t ReachabilityGame::getMaxLength() const {
     return (m_players.size() + 1) * getGraph().size();
 }
@@ -87,26 +140,125 @@ void ReachabilityGame::printDOT() const {
     std::cout << "}\n";
 }
 
-Long ReachabilityGame::AStartPositive(const Node::Ptr& node, const CostsMap &costsMap) {
-    const std::vector<Long> &epsilon = node->state.epsilon;
-    // g(n) = Coût vers les cibles déjà atteintes + coûts partiels (joueurs qui n'ont pas encore atteints une cible)
-    Long g_n = node->state.RP;
-    for (unsigned int notReached : node->state.notVisitedPlayers) {
-        g_n += epsilon[notReached];
-    }
+Long ReachabilityGame::AStartPositive(const Node::Ptr& node, const CostsMap &costsMap) const {
+    return exploration::heuristics::AStarPositive(*this)(node, costsMap);
+}
+
+void ReachabilityGame::setCoalitionThreads(std::size_t nThreads) {
+    m_cache->coalitionThreads = nThreads;
+}
+
+const std::vector<Long>& ReachabilityGame::getCoalitionValues(unsigned int player) const {
+    std::call_once(m_cache->coalitionFlags[player], [this, player]() {
+        std::call_once(m_cache->condensedFlag, [this]() {
+            const std::size_t nThreads = getGraph().size() >= parallelCondensationSize ? m_cache->coalitionThreads.load() : 1;
+            m_cache->condensed = std::make_unique<algorithms::CondensedMinMax>(CompactGame::fromReachabilityGame(*this), nThreads);
+        });
+        m_cache->coalitionValues[player] = algorithms::solveMinMax(*m_cache->condensed, player);
+    });
+    return m_cache->coalitionValues[player];
+}
+
+const CostsMap& ReachabilityGame::getCostsMap() const {
+    std::call_once(m_cache->costsFlag, [this]() {
+        m_cache->costs = computeAllDijkstra(*this);
+    });
+    return m_cache->costs;
+}
+
+const std::vector<Long>& ReachabilityGame::getTargetDistances() const {
+    std::call_once(m_cache->distancesFlag, [this]() {
+        const std::size_t size = getGraph().size();
+        const auto &vertices = getGraph().getVertices();
+        std::vector<Long> &distances = m_cache->distances;
+        distances.assign(m_players.size() * size, Long::infinity);
+
+        if (!hasNonNegativeWeights()) {
+            // Dijkstra ne termine pas sur un cycle négatif : Bellman-Ford, puis -infini pour les sommets qui peuvent encore descendre
+            for (unsigned int p = 0 ; p < m_players.size() ; p++) {
+                Long* distance = distances.data() + p * size;
+                for (const Vertex::Ptr &goal : m_players[p].getGoals()) {
+                    distance[goal->getID()] = 0;
+                }
+
+                std::vector<unsigned int> improving;
+                for (std::size_t round = 0 ; round <= size ; round++) {
+                    improving.clear();
+                    for (const Vertex::Ptr &vertex : vertices) {
+                        if (distance[vertex->getID()].isInfinity()) {
+                            continue;
+                        }
+                        for (auto pred = vertex->beginPredecessors() ; pred != vertex->endPredecessors() ; ++pred) {
+                            const Long candidate = distance[vertex->getID()] + pred->second.second[p];
+                            if (candidate < distance[pred->first]) {
+                                distance[pred->first] = candidate;
+                                improving.push_back(pred->first);
+                            }
+                        }
+                    }
+                    if (improving.empty()) {
+                        break;
+                    }
+                }
 
-    Long h_n = 0;
-    for (unsigned int notReached : node->state.notVisitedPlayers) {
-        Long shortest = Long::infinity;
-        for (const Vertex::Ptr goal : m_players[notReached].getGoals()) {
-            auto itr = costsMap.find(goal);
-            const CostsForATarget& target = itr->second;
-            shortest = std::min(shortest, target[node->path.getLast()->getID()]);
+                // Après size + 1 tours, les sommets encore améliorés (et ceux qui les atteignent) sont sur un chemin vers un cycle négatif
+                while (!improving.empty()) {
+                    const unsigned int v = improving.back();
+                    improving.pop_back();
+                    if (distance[v] == -Long::infinity) {
+                        continue;
+                    }
+                    distance[v] = -Long::infinity;
+                    for (auto pred = vertices[v]->beginPredecessors() ; pred != vertices[v]->endPredecessors() ; ++pred) {
+                        improving.push_back(pred->first);
+                    }
+                }
+            }
+            return;
         }
-        h_n += std::min(shortest, m_maxWeightsPath[notReached] - epsilon[notReached]);
-    }
 
-    return g_n + h_n;
+        typedef std::pair<long, unsigned int> Entry;
+        for (unsigned int p = 0 ; p < m_players.size() ; p++) {
+            Long* distance = distances.data() + p * size;
+            std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+            for (const Vertex::Ptr &goal : m_players[p].getGoals()) {
+                distance[goal->getID()] = 0;
+                queue.emplace(0, goal->getID());
+            }
+
+            while (!queue.empty()) {
+                const Entry top = queue.top();
+                queue.pop();
+                if (distance[top.second] < top.first) {
+                    // Entrée périmée : le sommet a déjà été fixé avec une distance plus petite
+                    continue;
+                }
+                const Vertex::Ptr &vertex = vertices[top.second];
+                for (auto pred = vertex->beginPredecessors() ; pred != vertex->endPredecessors() ; ++pred) {
+                    const Long candidate = Long(top.first) + pred->second.second[p];
+                    if (candidate < distance[pred->first]) {
+                        distance[pred->first] = candidate;
+                        queue.emplace(candidate.getValue(), pred->first);
+                    }
+                }
+            }
+        }
+    });
+    return m_cache->distances;
+}
+
+const algorithms::Symmetries& ReachabilityGame::getSymmetries() const {
+    std::call_once(m_cache->symmetriesFlag, [this]() {
+        m_cache->symmetries = std::make_unique<algorithms::Symmetries>(*this);
+    });
+    return *m_cache->symmetries;
+}
+
+const ForcedChains& ReachabilityGame::getForcedChains() const {
+    std::call_once(m_cache->forcedChainsFlag, [this]() {
+        m_cache->forcedChains = std::make_unique<ForcedChains>(*this);
+    });
+    return *m_cache->forcedChains;
 }
 
 std::size_t ReachabilityGame::percentageOfReachableVertices() const {
@@ -0,0 +1,216 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "algorithms/CondensedMinMax.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+
+#include "types/ThreadPool.hpp"
+
+using namespace types;
+
+namespace algorithms {
+    namespace {
+        const long infinity = std::numeric_limits<long>::max();
+
+        long add(long value, long weight) {
+            return value == infinity ? infinity : value + weight;
+        }
+    }
+
+    CondensedMinMax::CondensedMinMax(const CompactGame &game, std::size_t nThreads) :
+        m_game(game),
+        m_components(tarjanIterative(game.size(), game.getOffsets(), game.getSuccessors())),
+        m_predecessorOffsets(game.size() + 1, 0),
+        m_positions(game.size()),
+        m_nThreads(nThreads)
+        {
+        const std::size_t size = game.size();
+
+        for (std::size_t c = 0 ; c < m_components.size() ; c++) {
+            for (std::size_t i = m_components.offsets[c] ; i < m_components.offsets[c + 1] ; i++) {
+                m_positions[m_components.members[i]] = i - m_components.offsets[c];
+            }
+        }
+
+        // Arcs inversés, par tri par dénombrement
+        for (std::size_t e = 0 ; e < game.getNumberEdges() ; e++) {
+            m_predecessorOffsets[game.getSuccessor(e) + 1]++;
+        }
+        for (std::size_t v = 0 ; v < size ; v++) {
+            m_predecessorOffsets[v + 1] += m_predecessorOffsets[v];
+        }
+        m_predecessors.resize(game.getNumberEdges());
+        m_predecessorEdges.resize(game.getNumberEdges());
+        std::vector<std::size_t> next(m_predecessorOffsets.begin(), m_predecessorOffsets.end() - 1);
+        for (unsigned int v = 0 ; v < size ; v++) {
+            for (std::size_t e = game.beginEdges(v) ; e < game.endEdges(v) ; e++) {
+                const std::size_t slot = next[game.getSuccessor(e)]++;
+                m_predecessors[slot] = v;
+                m_predecessorEdges[slot] = e;
+            }
+        }
+
+        // Niveaux : les composantes sont numérotées dans l'ordre topologique inverse, leurs successeurs ont donc déjà un niveau
+        std::vector<std::size_t> levelOf(m_components.size(), 0);
+        std::size_t nLevels = 0;
+        for (std::size_t c = 0 ; c < m_components.size() ; c++) {
+            for (std::size_t i = m_components.offsets[c] ; i < m_components.offsets[c + 1] ; i++) {
+                const unsigned int v = m_components.members[i];
+                for (std::size_t e = game.beginEdges(v) ; e < game.endEdges(v) ; e++) {
+                    const unsigned int other = m_components.componentOf[game.getSuccessor(e)];
+                    if (other != c) {
+                        levelOf[c] = std::max(levelOf[c], levelOf[other] + 1);
+                    }
+                }
+            }
+            nLevels = std::max(nLevels, levelOf[c] + 1);
+        }
+        m_levelOffsets.assign(nLevels + 1, 0);
+        for (std::size_t level : levelOf) {
+            m_levelOffsets[level + 1]++;
+        }
+        for (std::size_t l = 0 ; l < nLevels ; l++) {
+            m_levelOffsets[l + 1] += m_levelOffsets[l];
+        }
+        m_levels.resize(m_components.size());
+        next.assign(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+        for (std::size_t c = 0 ; c < m_components.size() ; c++) {
+            m_levels[next[levelOf[c]]++] = c;
+        }
+    }
+
+    std::vector<Long> CondensedMinMax::solve(unsigned int player) const {
+        std::vector<long> values(m_game.size(), infinity);
+
+        // Le pool ne vit que le temps de la résolution : un objet gardé en cache n'occupe pas de threads entre deux appels
+        std::unique_ptr<ThreadPool> pool;
+        if (m_nThreads != 1 && getNumberComponents() > getNumberLevels()) {
+            pool = std::make_unique<ThreadPool>(m_nThreads);
+        }
+
+        for (std::size_t l = 0 ; l + 1 < m_levelOffsets.size() ; l++) {
+            const std::size_t first = m_levelOffsets[l], count = m_levelOffsets[l + 1] - first;
+            if (pool && count > 1) {
+                // Les composantes d'un niveau n'écrivent que les valeurs de leurs propres sommets
+                parallelFor(*pool, count, [&](std::size_t i, std::size_t) {
+                    solveComponent(player, m_levels[first + i], values);
+                });
+            }
+            else {
+                for (std::size_t i = 0 ; i < count ; i++) {
+                    solveComponent(player, m_levels[first + i], values);
+                }
+            }
+        }
+
+        std::vector<Long> result(values.size(), Long::infinity);
+        for (std::size_t v = 0 ; v < values.size() ; v++) {
+            if (values[v] != infinity) {
+                result[v] = values[v];
+            }
+        }
+        return result;
+    }
+
+    void CondensedMinMax::solveComponent(unsigned int player, std::size_t component, std::vector<long> &values) const {
+        const std::size_t offset = m_components.offsets[component], size = m_components.componentSize(component);
+        const unsigned int *members = m_components.members.data() + offset;
+
+        typedef std::pair<long, unsigned int> Entry;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        // Pour un sommet de Max : le nombre de successeurs dans la composante qui ne sont pas encore fixés
+        std::vector<std::size_t> remaining(size, 0);
+        std::vector<bool> fixed(size, false);
+
+        // Les successeurs hors de la composante ont déjà leur valeur
+        for (std::size_t i = 0 ; i < size ; i++) {
+            const unsigned int v = members[i];
+            if (m_game.isTargetFor(v, player)) {
+                values[v] = 0;
+                queue.emplace(0, v);
+                continue;
+            }
+
+            const bool min = m_game.getPlayer(v) == player;
+            long value = min ? infinity : 0;
+            for (std::size_t e = m_game.beginEdges(v) ; e < m_game.endEdges(v) ; e++) {
+                const unsigned int succ = m_game.getSuccessor(e);
+                if (m_components.componentOf[succ] == component) {
+                    remaining[i]++;
+                }
+                else {
+                    const long cost = add(values[succ], m_game.getWeights(e)[player]);
+                    value = min ? std::min(value, cost) : std::max(value, cost);
+                }
+            }
+            if (!min && m_game.getNumberSuccessors(v) == 0) {
+                value = infinity;
+            }
+
+            // Pour Max, values garde le plus grand coût des successeurs déjà fixés
+            values[v] = value;
+            if (value != infinity && (min || remaining[i] == 0)) {
+                queue.emplace(value, v);
+            }
+        }
+
+        // Dijkstra Min-Max dans la composante : un sommet est fixé quand il sort de la file
+        while (!queue.empty()) {
+            const Entry top = queue.top();
+            queue.pop();
+            const std::size_t index = m_positions[top.second];
+            if (fixed[index] || top.first != values[top.second]) {
+                continue;
+            }
+            fixed[index] = true;
+
+            for (std::size_t i = m_predecessorOffsets[top.second] ; i < m_predecessorOffsets[top.second + 1] ; i++) {
+                const unsigned int pred = m_predecessors[i];
+                if (m_components.componentOf[pred] != component || fixed[m_positions[pred]] || m_game.isTargetFor(pred, player)) {
+                    continue;
+                }
+                const long cost = top.first + m_game.getWeights(m_predecessorEdges[i])[player];
+                if (m_game.getPlayer(pred) == player) {
+                    if (cost < values[pred]) {
+                        values[pred] = cost;
+                        queue.emplace(cost, pred);
+                    }
+                }
+                else {
+                    values[pred] = std::max(values[pred], cost);
+                    if (--remaining[m_positions[pred]] == 0 && values[pred] != infinity) {
+                        queue.emplace(values[pred], pred);
+                    }
+                }
+            }
+        }
+
+        // Les sommets jamais fixés ne peuvent pas forcer une visite des cibles
+        for (std::size_t i = 0 ; i < size ; i++) {
+            if (!fixed[i]) {
+                values[members[i]] = infinity;
+            }
+        }
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "algorithms/IncrementalComponents.hpp"
+
+#include <stdexcept>
+
+namespace algorithms {
+    IncrementalComponents::IncrementalComponents(const ComponentIndex& index) :
+        m_slotOf(index.componentOf),
+        m_components(index.size()),
+        m_alive(index.size()),
+        m_positionOfSlot(index.size())
+        {
+        for (std::size_t c = 0 ; c < index.size() ; c++) {
+            m_components[c].assign(index.members.begin() + index.offsets[c], index.members.begin() + index.offsets[c + 1]);
+            m_alive[c] = c;
+            m_positionOfSlot[c] = c;
+        }
+    }
+
+    std::size_t IncrementalComponents::size() const {
+        return m_alive.size();
+    }
+
+    const std::vector<unsigned int>& IncrementalComponents::getComponent(std::size_t position) const {
+        return m_components[m_alive[position]];
+    }
+
+    std::size_t IncrementalComponents::positionOf(unsigned int vertex) const {
+        return m_positionOfSlot[m_slotOf[vertex]];
+    }
+
+    std::size_t IncrementalComponents::merge(std::size_t i, std::size_t j) {
+        if (i == j) {
+            throw std::runtime_error("IncrementalComponents: impossible de fusionner une composante avec elle-même");
+        }
+
+        unsigned int big = m_alive[i], small = m_alive[j];
+        if (m_components[big].size() < m_components[small].size()) {
+            std::swap(big, small);
+        }
+
+        // On déplace les sommets de la petite composante dans la grande
+        for (unsigned int v : m_components[small]) {
+            m_slotOf[v] = big;
+        }
+        m_components[big].insert(m_components[big].end(), m_components[small].begin(), m_components[small].end());
+        m_components[small] = std::vector<unsigned int>();
+
+        // On retire la petite composante en la remplaçant par la dernière
+        std::size_t hole = m_positionOfSlot[small];
+        m_alive[hole] = m_alive.back();
+        m_positionOfSlot[m_alive[hole]] = hole;
+        m_alive.pop_back();
+
+        return m_positionOfSlot[big];
+    }
+}
\ No newline at end of file
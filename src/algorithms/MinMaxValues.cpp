@@ -0,0 +1,137 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "algorithms/MinMaxValues.hpp"
+
+#include "algorithms/ValueIteration.hpp"
+
+using namespace types;
+
+namespace algorithms {
+    namespace {
+        /**
+         * \brief Les tableaux d'un jeu dont seuls les poids changent
+         */
+        struct ReweightedStorage {
+            CompactGame original;
+            std::vector<long> weights;
+        };
+    }
+
+    bool hasNegativeWeights(const CompactGame &game, unsigned int player) {
+        for (std::size_t e = 0 ; e < game.getNumberEdges() ; e++) {
+            if (game.getWeights(e)[player] < 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool computePotentials(const CompactGame &game, unsigned int player, std::vector<long> &potentials) {
+        const std::size_t size = game.size();
+        // Les cibles sont réunies en un seul sommet, d'indice size
+        potentials.assign(size + 1, 0);
+        auto slot = [&](unsigned int v) {
+            return game.isTargetFor(v, player) ? size : v;
+        };
+
+        // Au plus un tour par sommet (cibles réunies comprises) ; un tour de plus qui change encore quelque chose révèle un cycle négatif
+        bool changed = true;
+        for (std::size_t round = 0 ; changed ; round++) {
+            if (round > size + 1) {
+                return false;
+            }
+            changed = false;
+            for (unsigned int u = 0 ; u < size ; u++) {
+                if (game.isTargetFor(u, player)) {
+                    continue;
+                }
+                for (std::size_t e = game.beginEdges(u) ; e < game.endEdges(u) ; e++) {
+                    const std::size_t to = slot(game.getSuccessor(e));
+                    const long candidate = potentials[u] + game.getWeights(e)[player];
+                    if (candidate < potentials[to]) {
+                        potentials[to] = candidate;
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        const long target = potentials[size];
+        potentials.pop_back();
+        for (unsigned int v = 0 ; v < size ; v++) {
+            if (game.isTargetFor(v, player)) {
+                potentials[v] = target;
+            }
+        }
+        return true;
+    }
+
+    std::vector<Long> valueIterationMinMax(const CompactGame &game, unsigned int player) {
+        return ValueIteration(game).solve(player);
+    }
+
+    std::vector<Long> solveMinMax(const CondensedMinMax &condensed, unsigned int player, MinMaxEngine *engine) {
+        const CompactGame &game = condensed.getGame();
+        if (!hasNegativeWeights(game, player)) {
+            if (engine) {
+                *engine = MinMaxEngine::Dijkstra;
+            }
+            return condensed.solve(player);
+        }
+
+        std::vector<long> potentials;
+        if (!computePotentials(game, player, potentials)) {
+            if (engine) {
+                *engine = MinMaxEngine::ValueIteration;
+            }
+            return valueIterationMinMax(game, player);
+        }
+        if (engine) {
+            *engine = MinMaxEngine::Potentials;
+        }
+
+        // Même graphe, seuls les poids du joueur changent : w'(u, v) = w(u, v) + h(u) - h(v)
+        auto storage = std::make_shared<ReweightedStorage>(ReweightedStorage{game, std::vector<long>(game.getWeights(), game.getWeights() + game.getNumberEdges() * game.getNumberPlayers())});
+        for (unsigned int u = 0 ; u < game.size() ; u++) {
+            for (std::size_t e = game.beginEdges(u) ; e < game.endEdges(u) ; e++) {
+                long &weight = storage->weights[e * game.getNumberPlayers() + player];
+                // Les arcs qui partent d'une cible ne servent pas
+                weight = game.isTargetFor(u, player) ? 0 : weight + potentials[u] - potentials[game.getSuccessor(e)];
+            }
+        }
+        const CompactGame reweighted(game.size(), game.getNumberEdges(), game.getNumberPlayers(), game.getInit(), game.getOffsets(), game.getSuccessors(), storage->weights.data(), game.getOwners(), game.getTargets(), storage);
+
+        // Le coût d'un chemin de v vers une cible est décalé de h(v) - h(cible)
+        std::vector<Long> values = CondensedMinMax(reweighted).solve(player);
+        long target = 0;
+        for (unsigned int v = 0 ; v < game.size() ; v++) {
+            if (game.isTargetFor(v, player)) {
+                target = potentials[v];
+                break;
+            }
+        }
+        for (unsigned int v = 0 ; v < game.size() ; v++) {
+            if (values[v] != Long::infinity) {
+                values[v] = values[v] - potentials[v] + target;
+            }
+        }
+        return values;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,373 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "algorithms/Symmetries.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <set>
+
+#include "ReachabilityGame.hpp"
+
+namespace algorithms {
+    namespace {
+        /**
+         * \brief Mélange une valeur dans un hachage (finaliseur de splitmix64)
+         */
+        std::uint64_t mix(std::uint64_t hash, std::uint64_t value) {
+            value += 0x9E3779B97F4A7C15ULL + hash;
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+            return value ^ (value >> 31);
+        }
+
+        /**
+         * \brief Hache un multi-ensemble de valeurs (l'ordre des valeurs ne compte pas)
+         */
+        std::uint64_t hashMultiset(std::vector<std::uint64_t> &values) {
+            std::sort(values.begin(), values.end());
+            std::uint64_t hash = values.size();
+            for (std::uint64_t value : values) {
+                hash = mix(hash, value);
+            }
+            return hash;
+        }
+
+        std::size_t countClasses(std::vector<std::uint64_t> colours) {
+            std::sort(colours.begin(), colours.end());
+            return std::unique(colours.begin(), colours.end()) - colours.begin();
+        }
+
+        /**
+         * \brief Le jeu sous forme de tableaux, pour le raffinement
+         */
+        struct Structure {
+            struct Arc {
+                unsigned int other;
+                std::vector<long> weights;
+            };
+
+            explicit Structure(const ReachabilityGame &game) :
+                nVertices(game.getGraph().size()),
+                nPlayers(game.getPlayers().size()),
+                owner(nVertices),
+                targets(nVertices),
+                owned(nPlayers),
+                targetVertices(nPlayers),
+                successors(nVertices),
+                predecessors(nVertices) {
+                for (const Vertex::Ptr &vertex : game.getGraph().getVertices()) {
+                    const unsigned int v = vertex->getID();
+                    owner[v] = vertex->getPlayer();
+                    owned[owner[v]].push_back(v);
+                    for (unsigned int p = 0 ; p < nPlayers ; p++) {
+                        if (vertex->isTargetFor(p)) {
+                            targets[v].push_back(p);
+                            targetVertices[p].push_back(v);
+                        }
+                    }
+                    for (auto succ = vertex->cbegin() ; succ != vertex->cend() ; ++succ) {
+                        std::vector<long> weights(nPlayers);
+                        for (unsigned int p = 0 ; p < nPlayers ; p++) {
+                            weights[p] = succ->second.second[p].getValue();
+                        }
+                        const unsigned int to = succ->second.first.lock()->getID();
+                        successors[v].push_back(Arc{to, weights});
+                        predecessors[to].push_back(Arc{v, weights});
+                    }
+                }
+            }
+
+            std::size_t nVertices;
+            std::size_t nPlayers;
+            std::vector<unsigned int> owner;
+            std::vector<std::vector<unsigned int>> targets;
+            std::vector<std::vector<unsigned int>> owned;
+            std::vector<std::vector<unsigned int>> targetVertices;
+            std::vector<std::vector<Arc>> successors;
+            std::vector<std::vector<Arc>> predecessors;
+        };
+
+        /**
+         * \brief Une couleur par sommet et par joueur
+         */
+        struct Colouring {
+            std::vector<std::uint64_t> vertices;
+            std::vector<std::uint64_t> players;
+
+            std::size_t classes() const {
+                return countClasses(vertices) + countClasses(players);
+            }
+
+            bool discrete() const {
+                return countClasses(vertices) == vertices.size() && countClasses(players) == players.size();
+            }
+        };
+
+        /**
+         * \brief Une étape du raffinement : la nouvelle couleur résume l'ancienne et celles des voisins
+         */
+        Colouring refineOnce(const Structure &structure, const Colouring &colouring) {
+            Colouring next{std::vector<std::uint64_t>(structure.nVertices), std::vector<std::uint64_t>(structure.nPlayers)};
+            std::vector<std::uint64_t> values, perPlayer;
+
+            auto arcs = [&](const std::vector<Structure::Arc> &list) {
+                values.clear();
+                for (const Structure::Arc &arc : list) {
+                    perPlayer.clear();
+                    for (unsigned int p = 0 ; p < structure.nPlayers ; p++) {
+                        perPlayer.push_back(mix(colouring.players[p], arc.weights[p]));
+                    }
+                    values.push_back(mix(colouring.vertices[arc.other], hashMultiset(perPlayer)));
+                }
+                return hashMultiset(values);
+            };
+
+            for (unsigned int v = 0 ; v < structure.nVertices ; v++) {
+                std::uint64_t hash = mix(colouring.vertices[v], colouring.players[structure.owner[v]]);
+                values.clear();
+                for (unsigned int p : structure.targets[v]) {
+                    values.push_back(colouring.players[p]);
+                }
+                hash = mix(hash, hashMultiset(values));
+                hash = mix(hash, arcs(structure.successors[v]));
+                hash = mix(hash, ~arcs(structure.predecessors[v]));
+                next.vertices[v] = hash;
+            }
+
+            for (unsigned int p = 0 ; p < structure.nPlayers ; p++) {
+                values.clear();
+                for (unsigned int v : structure.owned[p]) {
+                    values.push_back(colouring.vertices[v]);
+                }
+                std::uint64_t hash = mix(colouring.players[p], hashMultiset(values));
+                values.clear();
+                for (unsigned int v : structure.targetVertices[p]) {
+                    values.push_back(colouring.vertices[v]);
+                }
+                next.players[p] = mix(hash, hashMultiset(values));
+            }
+            return next;
+        }
+
+        /**
+         * \brief Raffine deux colorations en même temps jusqu'à ce qu'aucune ne change plus de partition.
+         * 
+         * Les deux colorations font le même nombre d'étapes : des sommets qui se correspondent gardent la même couleur.
+         */
+        void refine(const Structure &structure, Colouring &a, Colouring &b) {
+            std::size_t classesA = a.classes(), classesB = b.classes();
+            for (std::size_t round = 0 ; round <= structure.nVertices + structure.nPlayers ; round++) {
+                Colouring nextA = refineOnce(structure, a), nextB = refineOnce(structure, b);
+                const std::size_t newA = nextA.classes(), newB = nextB.classes();
+                if (newA == classesA && newB == classesB) {
+                    return;
+                }
+                a = std::move(nextA);
+                b = std::move(nextB);
+                classesA = newA;
+                classesB = newB;
+            }
+        }
+
+        bool sameColours(const Colouring &a, const Colouring &b) {
+            std::vector<std::uint64_t> x = a.vertices, y = b.vertices;
+            std::sort(x.begin(), x.end());
+            std::sort(y.begin(), y.end());
+            if (x != y) {
+                return false;
+            }
+            x = a.players;
+            y = b.players;
+            std::sort(x.begin(), x.end());
+            std::sort(y.begin(), y.end());
+            return x == y;
+        }
+
+        /**
+         * \brief Donne un élément de la plus petite couleur qui n'est pas seule, ou size s'il n'y en a pas
+         */
+        std::size_t firstAmbiguous(const std::vector<std::uint64_t> &colours) {
+            std::vector<std::uint64_t> sorted = colours;
+            std::sort(sorted.begin(), sorted.end());
+            for (std::size_t i = 0 ; i + 1 < sorted.size() ; i++) {
+                if (sorted[i] == sorted[i + 1]) {
+                    return std::find(colours.begin(), colours.end(), sorted[i]) - colours.begin();
+                }
+            }
+            return colours.size();
+        }
+
+        /**
+         * \brief Vérifie qu'une permutation candidate préserve propriétaires, cibles et poids
+         */
+        bool isAutomorphism(const Structure &structure, const Automorphism &candidate) {
+            for (unsigned int v = 0 ; v < structure.nVertices ; v++) {
+                const unsigned int image = candidate.vertices[v];
+                if (structure.owner[image] != candidate.players[structure.owner[v]] || structure.targets[image].size() != structure.targets[v].size() || structure.successors[image].size() != structure.successors[v].size()) {
+                    return false;
+                }
+                for (unsigned int p : structure.targets[v]) {
+                    const auto &imageTargets = structure.targets[image];
+                    if (std::find(imageTargets.begin(), imageTargets.end(), candidate.players[p]) == imageTargets.end()) {
+                        return false;
+                    }
+                }
+                for (const Structure::Arc &arc : structure.successors[v]) {
+                    const auto &imageArcs = structure.successors[image];
+                    auto match = std::find_if(imageArcs.begin(), imageArcs.end(), [&](const Structure::Arc &other) {
+                        return other.other == candidate.vertices[arc.other];
+                    });
+                    if (match == imageArcs.end()) {
+                        return false;
+                    }
+                    for (unsigned int p = 0 ; p < structure.nPlayers ; p++) {
+                        if (match->weights[candidate.players[p]] != arc.weights[p]) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * \brief Cherche une symétrie qui envoie u sur v, en individualisant des deux côtés jusqu'à une coloration discrète
+         * \return Vrai si une symétrie a été trouvée (et vérifiée)
+         */
+        bool findAutomorphism(const Structure &structure, const Colouring &stable, unsigned int u, unsigned int v, Automorphism &result) {
+            Colouring a = stable, b = stable;
+            std::uint64_t salt = 1;
+            a.vertices[u] = b.vertices[v] = mix(stable.vertices[u], salt);
+            while (true) {
+                refine(structure, a, b);
+                if (!sameColours(a, b)) {
+                    return false;
+                }
+                if (a.discrete()) {
+                    break;
+                }
+
+                // On fixe arbitrairement un élément ambigu de chaque côté
+                salt++;
+                std::size_t x = firstAmbiguous(a.vertices);
+                if (x < a.vertices.size()) {
+                    const std::size_t y = std::find(b.vertices.begin(), b.vertices.end(), a.vertices[x]) - b.vertices.begin();
+                    a.vertices[x] = b.vertices[y] = mix(a.vertices[x], salt);
+                }
+                else {
+                    x = firstAmbiguous(a.players);
+                    const std::size_t y = std::find(b.players.begin(), b.players.end(), a.players[x]) - b.players.begin();
+                    a.players[x] = b.players[y] = mix(a.players[x], salt);
+                }
+            }
+
+            std::vector<std::pair<std::uint64_t, unsigned int>> index(structure.nVertices);
+            for (unsigned int w = 0 ; w < structure.nVertices ; w++) {
+                index[w] = {b.vertices[w], w};
+            }
+            std::sort(index.begin(), index.end());
+            result.vertices.resize(structure.nVertices);
+            for (unsigned int w = 0 ; w < structure.nVertices ; w++) {
+                result.vertices[w] = std::lower_bound(index.begin(), index.end(), std::make_pair(a.vertices[w], 0u))->second;
+            }
+            result.players.resize(structure.nPlayers);
+            for (unsigned int p = 0 ; p < structure.nPlayers ; p++) {
+                result.players[p] = std::find(b.players.begin(), b.players.end(), a.players[p]) - b.players.begin();
+            }
+            return isAutomorphism(structure, result);
+        }
+
+        unsigned int findRoot(std::vector<unsigned int> &parent, unsigned int x) {
+            while (parent[x] != x) {
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        }
+    }
+
+    Symmetries::Symmetries(const ReachabilityGame &game, std::size_t maxElements, std::size_t maxAttempts) {
+        const Structure structure(game);
+        Colouring stable{std::vector<std::uint64_t>(structure.nVertices, 1), std::vector<std::uint64_t>(structure.nPlayers, 1)};
+        Colouring copy = stable;
+        refine(structure, stable, copy);
+        m_vertexColours = stable.vertices;
+        m_playerColours = stable.players;
+
+        // Les sommets de même couleur sont des candidats ; les orbites déjà connues sont sautées
+        std::vector<unsigned int> order(structure.nVertices), orbit(structure.nVertices);
+        std::iota(order.begin(), order.end(), 0);
+        std::iota(orbit.begin(), orbit.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](unsigned int x, unsigned int y) {
+            return stable.vertices[x] < stable.vertices[y];
+        });
+
+        std::vector<Automorphism> generators;
+        std::size_t attempts = 0;
+        for (std::size_t i = 0 ; i < order.size() && attempts < maxAttempts ; ) {
+            std::size_t j = i;
+            while (j < order.size() && stable.vertices[order[j]] == stable.vertices[order[i]]) {
+                j++;
+            }
+            const unsigned int u = order[i];
+            for (std::size_t k = i + 1 ; k < j && attempts < maxAttempts ; k++) {
+                const unsigned int v = order[k];
+                if (findRoot(orbit, u) == findRoot(orbit, v)) {
+                    continue;
+                }
+                attempts++;
+                Automorphism automorphism;
+                if (findAutomorphism(structure, stable, u, v, automorphism)) {
+                    for (unsigned int w = 0 ; w < structure.nVertices ; w++) {
+                        orbit[findRoot(orbit, w)] = findRoot(orbit, automorphism.vertices[w]);
+                    }
+                    generators.push_back(std::move(automorphism));
+                }
+            }
+            i = j;
+        }
+
+        // On énumère le groupe engendré, en partant de l'identité
+        Automorphism identity{std::vector<unsigned int>(structure.nVertices), std::vector<unsigned int>(structure.nPlayers)};
+        std::iota(identity.vertices.begin(), identity.vertices.end(), 0);
+        std::iota(identity.players.begin(), identity.players.end(), 0);
+        std::set<std::pair<std::vector<unsigned int>, std::vector<unsigned int>>> seen{{identity.vertices, identity.players}};
+        std::queue<Automorphism> queue;
+        queue.push(identity);
+        while (!queue.empty() && m_elements.size() < maxElements) {
+            const Automorphism current = std::move(queue.front());
+            queue.pop();
+            for (const Automorphism &generator : generators) {
+                Automorphism composed{std::vector<unsigned int>(structure.nVertices), std::vector<unsigned int>(structure.nPlayers)};
+                for (unsigned int w = 0 ; w < structure.nVertices ; w++) {
+                    composed.vertices[w] = generator.vertices[current.vertices[w]];
+                }
+                for (unsigned int p = 0 ; p < structure.nPlayers ; p++) {
+                    composed.players[p] = generator.players[current.players[p]];
+                }
+                if (seen.emplace(composed.vertices, composed.players).second && m_elements.size() < maxElements) {
+                    m_elements.push_back(composed);
+                    queue.push(std::move(composed));
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
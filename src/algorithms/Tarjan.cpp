@@ -19,82 +19,119 @@
 #include "algorithms/Tarjan.hpp"
 
 #include <vector>
-#include <stack>
+#include <limits>
 #include <algorithm>
 
 // Les algorithmes sont inspirés du pseudo-code de la page Wikipédia (https://en.wikipedia.org/wiki/Tarjan%27s_strongly_connected_components_algorithm)
+// La récursion est remplacée par une pile explicite afin de pouvoir traiter des graphes avec des millions de sommets
 
-/**
- * \brief Le coeur de Tarjan
- * \param v L'ID du sommet actuel
- * \param index L'index (selon le pseudo-code)
- * \param indices Le tableau des index
- * \param lowLink Le tableau des lowLink (selon le pseudo-code)
- * \param stack La pile
- * \param onStack Un tableau de booléen indiquant si tel sommet est sur la pile ou non
- * \param vertices L'ensemble des sommets
- */
-algorithms::stronglyConnectedComponents strongConnect(unsigned int v, std::size_t &index, std::vector<std::size_t> &indices, std::vector<std::size_t> &lowLink, std::stack<unsigned int> &stack, std::vector<bool> &onStack, const std::vector<Vertex::Ptr>& vertices) {
-    indices[v] = index;
-    lowLink[v] = index;
-    index++;
-
-    stack.push(v);
-    onStack[v] = true;
-
-    algorithms::stronglyConnectedComponents components;
-
-    for (const auto &e : *vertices[v]) {
-        unsigned int w = e.first;
-
-        if (indices[w] == 0) {
-            auto compo = strongConnect(w, index, indices, lowLink, stack, onStack, vertices);
-            components.insert(compo.begin(), compo.end());
-            lowLink[v] = std::min(lowLink[v], lowLink[w]);
-        }
-        else if (onStack[w]) {
-            lowLink[v] = std::min(lowLink[v], indices[w]);
+namespace algorithms {
+    stronglyConnectedComponents tarjan(const Graph& graph) {
+        ComponentIndex index = tarjanIterative(graph);
+
+        stronglyConnectedComponents components;
+        components.reserve(index.size());
+
+        for (std::size_t c = 0 ; c < index.size() ; c++) {
+            components.emplace(index.members.begin() + index.offsets[c], index.members.begin() + index.offsets[c + 1]);
         }
+
+        return components;
     }
 
-    algorithms::stronglyConnectedComponent component;
-    if (lowLink[v] == indices[v]) {
-        unsigned int w = stack.top();
-        stack.pop();
-        onStack[w] = false;
-        component.insert(w);
-
-        while (w != v) {
-            w = stack.top();
-            stack.pop();
-            onStack[w] = false;
-            component.insert(w);
+    ComponentIndex tarjanIterative(std::size_t size, const std::size_t* offsets, const unsigned int* successors) {
+        // Un sommet pas encore visité n'a pas d'index. Un sommet visité qui n'a pas encore de composante est sur la pile
+        const unsigned int undefined = std::numeric_limits<unsigned int>::max();
+
+        std::vector<unsigned int> indices(size, undefined);
+        std::vector<unsigned int> lowLink(size, 0);
+        std::vector<std::size_t> nextEdge(size, 0); // Pour chaque sommet sur la pile d'appels, le prochain arc à explorer
+        std::vector<unsigned int> callStack; // Remplace la pile de la récursion
+        std::vector<unsigned int> stack; // La pile S du pseudo-code
+        callStack.reserve(size);
+        stack.reserve(size);
+
+        ComponentIndex result;
+        result.componentOf.assign(size, undefined);
+        result.members.reserve(size);
+        result.offsets.push_back(0);
+
+        unsigned int index = 0;
+
+        for (std::size_t root = 0 ; root < size ; root++) {
+            if (indices[root] != undefined) {
+                continue;
+            }
+
+            indices[root] = lowLink[root] = index++;
+            nextEdge[root] = offsets[root];
+            stack.push_back(root);
+            callStack.push_back(root);
+
+            while (!callStack.empty()) {
+                unsigned int v = callStack.back();
+
+                if (nextEdge[v] < offsets[v + 1]) {
+                    unsigned int w = successors[nextEdge[v]++];
+
+                    if (indices[w] == undefined) {
+                        // Equivalent de l'appel récursif strongConnect(w)
+                        indices[w] = lowLink[w] = index++;
+                        nextEdge[w] = offsets[w];
+                        stack.push_back(w);
+                        callStack.push_back(w);
+                    }
+                    else if (result.componentOf[w] == undefined) {
+                        // w est sur la pile
+                        lowLink[v] = std::min(lowLink[v], indices[w]);
+                    }
+                }
+                else {
+                    // Tous les successeurs de v ont été explorés : on "revient" de l'appel
+                    callStack.pop_back();
+
+                    if (lowLink[v] == indices[v]) {
+                        // v est la racine d'une composante
+                        unsigned int component = result.offsets.size() - 1;
+                        unsigned int w;
+                        do {
+                            w = stack.back();
+                            stack.pop_back();
+                            result.componentOf[w] = component;
+                            result.members.push_back(w);
+                        } while (w != v);
+                        result.offsets.push_back(result.members.size());
+                    }
+
+                    if (!callStack.empty()) {
+                        unsigned int parent = callStack.back();
+                        lowLink[parent] = std::min(lowLink[parent], lowLink[v]);
+                    }
+                }
+            }
         }
 
-        components.insert(component);
+        return result;
     }
 
-    return components;
-}
-
-namespace algorithms {
-    stronglyConnectedComponents tarjan(const Graph& graph) {
-        std::size_t size = graph.size();
-        std::size_t index = 1;
-        std::vector<std::size_t> indices(size, 0);
-        std::vector<std::size_t> lowLink(size, 0);
-        std::stack<unsigned int> stack;
-        std::vector<bool> onStack(size, false);
+    ComponentIndex tarjanIterative(const Graph& graph) {
+        const std::vector<Vertex::Ptr>& vertices = graph.getVertices();
+        std::size_t size = vertices.size();
 
-        stronglyConnectedComponents components;
+        // On met le graphe sous forme CSR
+        std::vector<std::size_t> offsets(size + 1, 0);
+        for (std::size_t v = 0 ; v < size ; v++) {
+            offsets[v + 1] = offsets[v] + vertices[v]->getNumberSuccessors();
+        }
 
-        for (const Vertex::Ptr v : graph.getVertices()) {
-            if (indices[v->getID()] == 0) {
-                auto compo = strongConnect(v->getID(), index, indices, lowLink, stack, onStack, graph.getVertices());
-                components.insert(compo.begin(), compo.end());
+        std::vector<unsigned int> successors(offsets[size]);
+        for (std::size_t v = 0 ; v < size ; v++) {
+            std::size_t position = offsets[v];
+            for (auto e = vertices[v]->cbegin() ; e != vertices[v]->cend() ; ++e) {
+                successors[position++] = e->first;
             }
         }
 
-        return components;
+        return tarjanIterative(size, offsets.data(), successors.data());
     }
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "algorithms/ValueIteration.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+using namespace types;
+
+namespace algorithms {
+    namespace {
+        const long infinity = std::numeric_limits<long>::max();
+        const long minusInfinity = std::numeric_limits<long>::min();
+    }
+
+    ValueIteration::ValueIteration(const CompactGame &game, std::size_t nThreads, Sweep sweep, std::size_t blockSize) :
+        m_game(game),
+        m_sweep(sweep),
+        m_blockSize(blockSize)
+        {
+        if (blockSize == 0) {
+            throw std::runtime_error("ValueIteration: un bloc doit contenir au moins un sommet");
+        }
+        if (nThreads != 1) {
+            m_pool = std::make_unique<ThreadPool>(nThreads);
+        }
+    }
+
+    template <typename Read, typename Write>
+    bool ValueIteration::sweepBlock(unsigned int player, std::size_t block, long lowest, Read &&read, Write &&write) const {
+        const unsigned int first = block * m_blockSize;
+        const unsigned int last = std::min(m_game.size(), (block + 1) * m_blockSize);
+        bool changed = false;
+        for (unsigned int v = first ; v < last ; v++) {
+            const long old = read(v);
+            if (m_game.isTargetFor(v, player) || m_game.getNumberSuccessors(v) == 0 || old == minusInfinity) {
+                write(v, old);
+                continue;
+            }
+
+            const bool min = m_game.getPlayer(v) == player;
+            long value = min ? infinity : minusInfinity;
+            for (std::size_t e = m_game.beginEdges(v) ; e < m_game.endEdges(v) ; e++) {
+                const long succ = read(m_game.getSuccessor(e));
+                const long cost = succ == infinity || succ == minusInfinity ? succ : succ + m_game.getWeights(e)[player];
+                value = min ? std::min(value, cost) : std::max(value, cost);
+            }
+            if (value != minusInfinity && value < lowest) {
+                value = minusInfinity;
+            }
+            if (value < old) {
+                changed = true;
+                write(v, value);
+            }
+            else {
+                write(v, old);
+            }
+        }
+        return changed;
+    }
+
+    std::vector<Long> ValueIteration::solve(unsigned int player, std::size_t *sweeps) const {
+        const std::size_t size = m_game.size();
+        const std::size_t nBlocks = (size + m_blockSize - 1) / m_blockSize;
+
+        long maxWeight = 0;
+        for (std::size_t e = 0 ; e < m_game.getNumberEdges() ; e++) {
+            maxWeight = std::max(maxWeight, std::labs(m_game.getWeights(e)[player]));
+        }
+        const long lowest = -long(size > 0 ? size - 1 : 0) * maxWeight;
+
+        // En Gauss-Seidel, des blocs traités en même temps lisent et écrivent les mêmes valeurs : elles sont atomiques
+        std::vector<std::atomic<long>> current(size);
+        std::vector<long> next(m_sweep == Sweep::Jacobi ? size : 0);
+        for (unsigned int v = 0 ; v < size ; v++) {
+            current[v].store(m_game.isTargetFor(v, player) ? 0 : infinity, std::memory_order_relaxed);
+        }
+        auto read = [&](unsigned int v) {
+            return current[v].load(std::memory_order_relaxed);
+        };
+        auto writeInPlace = [&](unsigned int v, long value) {
+            current[v].store(value, std::memory_order_relaxed);
+        };
+        auto writeNext = [&](unsigned int v, long value) {
+            next[v] = value;
+        };
+
+        std::size_t nSweeps = 0;
+        std::atomic<bool> changed(true);
+        while (changed) {
+            changed = false;
+            auto process = [&](std::size_t block) {
+                const bool blockChanged = m_sweep == Sweep::Jacobi ? sweepBlock(player, block, lowest, read, writeNext) : sweepBlock(player, block, lowest, read, writeInPlace);
+                if (blockChanged) {
+                    changed = true;
+                }
+            };
+            if (m_pool && nBlocks > 1) {
+                parallelFor(*m_pool, nBlocks, [&](std::size_t block, std::size_t) {
+                    process(block);
+                });
+            }
+            else {
+                for (std::size_t block = 0 ; block < nBlocks ; block++) {
+                    process(block);
+                }
+            }
+            if (m_sweep == Sweep::Jacobi) {
+                for (unsigned int v = 0 ; v < size ; v++) {
+                    current[v].store(next[v], std::memory_order_relaxed);
+                }
+            }
+            nSweeps++;
+        }
+
+        if (sweeps) {
+            *sweeps = nSweeps;
+        }
+        std::vector<Long> result(size);
+        for (unsigned int v = 0 ; v < size ; v++) {
+            const long value = read(v);
+            result[v] = value == infinity ? Long::infinity : value == minusInfinity ? -Long::infinity : Long(value);
+        }
+        return result;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "exploration/BeamSearch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <tuple>
+
+#include "types/ThreadPool.hpp"
+
+using namespace types;
+
+namespace exploration {
+    namespace {
+        /**
+         * \brief Un successeur en attente, avec sa place dans l'ordre de génération
+         */
+        struct Candidate {
+            Node::Ptr node;
+            std::size_t parent;
+            std::size_t child;
+        };
+
+        /**
+         * \brief Vrai si a passe avant b : coût plus petit, puis généré plus tôt
+         */
+        bool before(const Candidate &a, const Candidate &b) {
+            if (a.node->pathCost != b.node->pathCost) {
+                return a.node->pathCost < b.node->pathCost;
+            }
+            return std::tie(a.parent, a.child) < std::tie(b.parent, b.child);
+        }
+
+        /**
+         * \brief Ajoute un candidat à un tas qui garde au plus width éléments (le moins bon au sommet)
+         */
+        void keepBest(std::vector<Candidate> &heap, Candidate candidate, std::size_t width) {
+            if (heap.size() < width) {
+                heap.push_back(std::move(candidate));
+                std::push_heap(heap.begin(), heap.end(), before);
+            }
+            else if (before(candidate, heap.front())) {
+                std::pop_heap(heap.begin(), heap.end(), before);
+                heap.back() = std::move(candidate);
+                std::push_heap(heap.begin(), heap.end(), before);
+            }
+        }
+    }
+
+    Path beamSearch(const ReachabilityGame &game, const heuristicSignature &heuristic, std::size_t beamWidth, Long allowedTime, std::size_t nThreads) {
+        const std::size_t nPlayers = game.getGraph().getNumberPlayers();
+        const std::size_t width = std::max<std::size_t>(beamWidth, 1);
+        const CostsMap &costsMap = game.getCostsMap();
+
+        Path path(game, game.getInit());
+        Node::Ptr init = std::make_shared<Node>(nPlayers, path);
+        for (unsigned int player : game.getInit()->getTargetPlayers()) {
+            init->state.notVisitedPlayers.erase(player);
+        }
+        init->pathCost = heuristic(init, costsMap);
+
+        std::unordered_set<unsigned int> allPlayers;
+        for (unsigned int i = 0 ; i < nPlayers ; i++) {
+            allPlayers.insert(i);
+        }
+
+        ThreadPool pool(nThreads);
+        // Par thread : les meilleurs successeurs et une copie de allPlayers (modifiée par expandNode)
+        std::vector<std::vector<Candidate>> heaps(pool.size());
+        std::vector<std::unordered_set<unsigned int>> players(pool.size(), allPlayers);
+
+        std::optional<Path> best;
+        Long bestCost = Long::infinity;
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<Node::Ptr> level{init}, toExpand;
+
+        while (!level.empty()) {
+            if (!allowedTime.isInfinity() && std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= allowedTime.getValue()) {
+                if (best) {
+                    return *best;
+                }
+                throw OutOfTime("L'exploration s'est achevée par manque de temps");
+            }
+
+            // Les noeuds terminaux donnent des équilibres ; les autres seront développés
+            toExpand.clear();
+            for (const Node::Ptr &node : level) {
+                if (node->state.notVisitedPlayers.size() == 0 || node->path.size() == game.getMaxLength()) {
+                    if (node->pathCost < bestCost && (node->state.notVisitedPlayers.size() == 0 || node->path.isANashEquilibrium(node->state.notVisitedPlayers))) {
+                        best.emplace(node->path);
+                        bestCost = node->pathCost;
+                    }
+                }
+                else if (node->pathCost < bestCost) {
+                    // Un noeud dont l'heuristique dépasse déjà le meilleur équilibre ne peut pas l'améliorer
+                    toExpand.push_back(node);
+                }
+            }
+
+            parallelFor(pool, toExpand.size(), [&](std::size_t i, std::size_t t) {
+                std::size_t child = 0;
+                expandNode(toExpand[i], nPlayers, heuristic, costsMap, players[t], [&](const Node::Ptr &newNode) {
+                    keepBest(heaps[t], Candidate{newNode, i, child++}, width);
+                });
+            });
+
+            // On fusionne les meilleurs successeurs de chaque thread
+            std::vector<Candidate> merged;
+            for (std::vector<Candidate> &heap : heaps) {
+                for (Candidate &candidate : heap) {
+                    keepBest(merged, std::move(candidate), width);
+                }
+                heap.clear();
+            }
+            std::sort(merged.begin(), merged.end(), before);
+
+            level.clear();
+            for (Candidate &candidate : merged) {
+                level.push_back(std::move(candidate.node));
+            }
+        }
+
+        if (best) {
+            return *best;
+        }
+        throw EmptyFrontier("Le faisceau ne contient plus aucun noeud");
+    }
+}
\ No newline at end of file
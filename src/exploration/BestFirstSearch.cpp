@@ -18,9 +18,8 @@
 
 #include "exploration/BestFirstSearch.hpp"
 
-#include <queue>
-#include <memory>
-#include <chrono>
+#include <algorithm>
+#include <limits>
 
 #include "MinMaxGame.hpp"
 #include "Path.hpp"
@@ -29,23 +28,6 @@
 using namespace types;
 
 namespace exploration {
-    /**
-     * \brief Comparaison entre deux noeuds de l'exploration
-     */
-    struct CompareNodes {
-        /** \brief Compare deux Node::Ptr */
-        bool operator()(const Node::Ptr& a, const Node::Ptr &b) const {
-            return a->pathCost > b->pathCost;
-        }
-    };
-
-    /**
-     * \brief Calcule tous les coûts par Dijkstra.
-     * 
-     * Pour chacune des cibles du jeu, calcule les coûts pour y arriver à partir de chaque sommet
-     * \param game Le jeu
-     * \return Une map qui associe à chaque cible un tableau de coût (une valeur par sommet)
-     */
     CostsMap computeAllDijkstra(const ReachabilityGame &game) {
         CostsMap res;
         std::unordered_set<Vertex::Ptr> goals;
@@ -60,110 +42,58 @@ namespace exploration {
         return res;
     }
 
-    Path bestFirstSearch(const ReachabilityGame& game, const heuristicSignature& heuristic, Long allowedTime) {
-        std::size_t nPlayers = game.getGraph().getNumberPlayers();
-
-        CostsMap costsMap = computeAllDijkstra(game);
-
-        // On initialise le premier noeud de l'exploration
-        Path path(game, game.getInit());
-        Node::Ptr init = std::make_shared<Node>(nPlayers, path);
-        for (unsigned int player : game.getInit()->getTargetPlayers()) {
-            init->state.notVisitedPlayers.erase(player);
-        }
-        init->pathCost = heuristic(init, costsMap);
-
-        // On construit la frontière avec le noeud créé
-        std::priority_queue<Node::Ptr, std::vector<Node::Ptr>, CompareNodes> frontier;
-        frontier.push(init);
-
-        std::unordered_set<unsigned int> allPlayers;
-        for (unsigned int i = 0 ; i < nPlayers ; i++) {
-            allPlayers.insert(i);
+    void updateBound(Node &node, const ReachabilityGame &game) {
+        const std::shared_ptr<const Vertex> last = node.path.getLast();
+        const unsigned int player = last->getPlayer();
+        if (node.state.notVisitedPlayers.count(player) != 0) {
+            const Long value = game.getCoalitionValues(player)[last->getID()] + node.state.epsilon[player];
+            node.state.bounds[player] = std::min(node.state.bounds[player], value);
         }
+    }
 
-        auto start = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-
-        while(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count() - start < allowedTime) {
-            if (frontier.empty()) {
-                throw EmptyFrontier("La frontière est vide");
-            }
-
-            Node::Ptr currentNode = frontier.top();
-            frontier.pop();
-
-            if (currentNode->state.notVisitedPlayers.size() == 0) {
-                // Tout le monde a vu une cible. On a donc un équilibre de Nash (si exploration optimale)
-                return currentNode->path;
-            }
-            else if (currentNode->path.size() == game.getMaxLength()) {
-                // On a atteint la longueur maximale
-                // Il se peut que ce soit un équilibre de Nash
-                // On va vérifier pour les joueurs qui n'ont pas encore atteint un objectif
-
-                if (currentNode->path.isANashEquilibrium(currentNode->state.notVisitedPlayers)) {
-                    // On a un EN
-                    return currentNode->path;
-                }
+    std::vector<long> transpositionKey(const Node &node) {
+        const std::size_t nPlayers = node.state.epsilon.size();
+        std::vector<long> key(2 + 2 * nPlayers, std::numeric_limits<long>::min());
+        key[0] = node.path.getLast()->getID();
+        key[1] = node.path.size();
+        for (unsigned int player : node.state.notVisitedPlayers) {
+            const Long &bound = node.state.bounds[player];
+            key[2 + 2 * player] = node.state.epsilon[player].getValue();
+            // Les infinis sont codés aux extrémités : getValue() n'en donne que le signe, qui se confondrait avec une borne finie
+            if (bound.isInfinity()) {
+                key[3 + 2 * player] = bound > 0 ? std::numeric_limits<long>::max() : std::numeric_limits<long>::min();
             }
             else {
-                const std::shared_ptr<const Vertex> last = currentNode->path.getLast();
-
-                // On va itérer sur chaque successeur du dernier sommet du chemin
-                for (auto succEdge = last->cbegin() ; succEdge != last->cend() ; succEdge++) {
-                    const Vertex::Ptr succ = succEdge->second.first.lock();
-                    const std::vector<Long>& w = succEdge->second.second;
-
-                    // On copie le noeud et on ajoute un pas
-                    Node::Ptr newNode = std::make_shared<Node>(currentNode);
-                    newNode->path.addStep(succ);
-
-                    // On met à jour les coûts en ajoutant le coût de l'arc emprunté
-                    for (std::size_t i = 0 ; i < nPlayers ; i++) {
-                        newNode->state.epsilon[i] = w[i] + currentNode->state.epsilon[i];
-                    }
+                key[3 + 2 * player] = bound.getValue();
+            }
+        }
+        return key;
+    }
 
-                    if (succ->isTarget()) {
-                        std::unordered_set<unsigned int> newReached;
-                        for (unsigned int p : newNode->state.notVisitedPlayers) {
-                            if (succ->isTargetFor(p)) {
-                                newReached.insert(p);
-                            }
-                        }
+    std::vector<long> transpositionKey(const Node &node, const algorithms::Symmetries &symmetries) {
+        std::vector<long> key = transpositionKey(node);
+        if (symmetries.empty()) {
+            return key;
+        }
 
-                        if (newReached.size() != 0) {
-                            // On a des joueurs qui atteignent une cible pour la première fois
-                            bool nash = true;
-                            // On vérifie si on a un équilibre de Nash pour chaque joueur
-                            for (unsigned int p : newReached) {
-                                allPlayers.erase(p);
-                                if (!newNode->path.isANashEquilibrium(allPlayers)) {
-                                    nash = false;
-                                }
-                                allPlayers.insert(p);
-                            }
-                            // Si oui, on va ajouter un nouveau noeud à la frontière
-                            if (nash) {
-                                for (unsigned int p : newReached) {
-                                    newNode->state.notVisitedPlayers.erase(p);
-                                    newNode->state.RP += newNode->state.epsilon[p];
-                                }
-                                newNode->pathCost = heuristic(newNode, costsMap);
-                                frontier.push(newNode);
-                            }
-                        }
-                        else {
-                            newNode->pathCost = heuristic(newNode, costsMap);
-                            frontier.push(newNode);
-                        }
-                    } 
-                    else {
-                        newNode->pathCost = heuristic(newNode, costsMap);
-                        frontier.push(newNode);
-                    }
-                }
+        const std::size_t nPlayers = node.state.epsilon.size();
+        std::vector<long> best = key, image(key.size());
+        for (const algorithms::Automorphism &automorphism : symmetries.getAutomorphisms()) {
+            image[0] = automorphism.vertices[key[0]];
+            image[1] = key[1];
+            for (unsigned int player = 0 ; player < nPlayers ; player++) {
+                const unsigned int to = automorphism.players[player];
+                image[2 + 2 * to] = key[2 + 2 * player];
+                image[3 + 2 * to] = key[3 + 2 * player];
+            }
+            if (image < best) {
+                best.swap(image);
             }
         }
-        throw OutOfTime("L'exploration s'est achevée par manque de temps");
+        return best;
+    }
+
+    Path bestFirstSearch(const ReachabilityGame& game, const heuristicSignature& heuristic, Long allowedTime, SearchStatistics *statistics, TieBreaking tieBreaking, bool useSymmetries) {
+        return bestFirstSearch<heuristicSignature>(game, heuristic, allowedTime, statistics, tieBreaking, useSymmetries);
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,253 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "exploration/BidirectionalSearch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <queue>
+
+#include "CompactGame.hpp"
+#include "exploration/BestFirstSearch.hpp"
+#include "exploration/Heuristics.hpp"
+
+using namespace types;
+
+namespace exploration {
+    namespace {
+        const long unreached = std::numeric_limits<long>::max();
+        const unsigned int bothPlayers = 3;
+        const std::size_t none = std::numeric_limits<std::size_t>::max();
+
+        /**
+         * \brief Une des deux recherches : distances, prédécesseurs et file de priorité sur les états (sommet * 4 + joueurs)
+         */
+        struct Search {
+            explicit Search(std::size_t nStates) :
+                distances(nStates, unreached),
+                previous(nStates, none),
+                edges(nStates, none),
+                settled(nStates, false)
+                {
+
+            }
+
+            void relax(std::size_t state, long distance, std::size_t from, std::size_t edge) {
+                if (distance < distances[state]) {
+                    distances[state] = distance;
+                    previous[state] = from;
+                    edges[state] = edge;
+                    queue.emplace(distance, state);
+                }
+            }
+
+            /**
+             * \brief Retire les états déjà fixés du sommet de la file
+             * \return La distance du prochain état à fixer (unreached si la file est vide)
+             */
+            long top() {
+                while (!queue.empty() && settled[queue.top().second]) {
+                    queue.pop();
+                }
+                return queue.empty() ? unreached : queue.top().first;
+            }
+
+            std::vector<long> distances;
+            /** \brief L'état voisin sur le meilleur chemin (le précédent en avant, le suivant en arrière) */
+            std::vector<std::size_t> previous;
+            /** \brief L'arc vers cet état voisin */
+            std::vector<std::size_t> edges;
+            std::vector<char> settled;
+            std::priority_queue<std::pair<long, std::size_t>, std::vector<std::pair<long, std::size_t>>, std::greater<std::pair<long, std::size_t>>> queue;
+        };
+
+        /**
+         * \brief Le coût d'un arc pour les joueurs qui n'ont pas encore vu leur cible
+         */
+        long edgeCost(const CompactGame &compact, std::size_t edge, unsigned int reached) {
+            const long* weights = compact.getWeights(edge);
+            long cost = 0;
+            for (unsigned int p = 0 ; p < 2 ; p++) {
+                if (!((reached >> p) & 1)) {
+                    cost += weights[p];
+                }
+            }
+            return cost;
+        }
+
+        Path fallback(const ReachabilityGame &game, Long allowedTime, std::chrono::steady_clock::time_point start, BidirectionalStatistics *statistics) {
+            if (statistics) {
+                statistics->usedFallback = true;
+            }
+            if (!allowedTime.isInfinity()) {
+                // A* ne reçoit que le temps laissé par la recherche bidirectionnelle (en secondes entières, comme searchContracted)
+                allowedTime = allowedTime - Long(long(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count()));
+                if (allowedTime <= 0) {
+                    throw OutOfTime("L'exploration s'est achevée par manque de temps");
+                }
+            }
+            return bestFirstSearch(game, heuristics::AStarPositive(game), allowedTime);
+        }
+    }
+
+    Path bidirectionalSearch(const ReachabilityGame &game, Long allowedTime, BidirectionalStatistics *statistics) {
+        const auto start = std::chrono::steady_clock::now();
+        if (game.getPlayers().size() != 2) {
+            return fallback(game, allowedTime, start, statistics);
+        }
+
+        const CompactGame compact = CompactGame::fromReachabilityGame(game);
+        const std::size_t nVertices = compact.size(), nEdges = compact.getNumberEdges();
+        if (std::any_of(compact.getWeights(), compact.getWeights() + 2 * nEdges, [](long w) { return w < 0; })) {
+            return fallback(game, allowedTime, start, statistics);
+        }
+
+        auto targets = [&compact](unsigned int v) {
+            return static_cast<unsigned int>(compact.getTargets()[v] & bothPlayers);
+        };
+        const auto &vertices = game.getGraph().getVertices();
+
+        const unsigned int init = compact.getInit();
+        if (targets(init) == bothPlayers) {
+            return Path(game, vertices[init]);
+        }
+
+        // Les arcs inversés : pour chaque sommet, les indices des arcs qui y arrivent
+        std::vector<std::size_t> reverseOffsets(nVertices + 1, 0), reverseEdges(nEdges);
+        for (std::size_t e = 0 ; e < nEdges ; e++) {
+            reverseOffsets[compact.getSuccessor(e) + 1]++;
+        }
+        for (std::size_t v = 0 ; v < nVertices ; v++) {
+            reverseOffsets[v + 1] += reverseOffsets[v];
+        }
+        std::vector<unsigned int> sources(nEdges);
+        {
+            std::vector<std::size_t> next(reverseOffsets.begin(), reverseOffsets.end() - 1);
+            for (unsigned int u = 0 ; u < nVertices ; u++) {
+                for (std::size_t e = compact.beginEdges(u) ; e < compact.endEdges(u) ; e++) {
+                    sources[next[compact.getSuccessor(e)]] = u;
+                    reverseEdges[next[compact.getSuccessor(e)]++] = e;
+                }
+            }
+        }
+
+        const std::size_t nStates = 4 * nVertices;
+        Search forward(nStates), backward(nStates);
+
+        forward.relax(std::size_t(init) * 4 + targets(init), 0, none, none);
+        // Les chemins se terminent dès que les deux joueurs ont vu leur cible : on part des sommets où cela peut arriver
+        for (unsigned int v = 0 ; v < nVertices ; v++) {
+            if (targets(v) != 0) {
+                backward.relax(std::size_t(v) * 4 + bothPlayers, 0, none, none);
+            }
+        }
+
+        long best = unreached;
+        std::size_t meeting = none;
+        auto meet = [&](std::size_t state) {
+            if (forward.distances[state] != unreached && backward.distances[state] != unreached && forward.distances[state] + backward.distances[state] < best) {
+                best = forward.distances[state] + backward.distances[state];
+                meeting = state;
+            }
+        };
+
+        std::size_t nSettled = 0;
+
+        while (true) {
+            const long topForward = forward.top(), topBackward = backward.top();
+            if (topForward == unreached || topBackward == unreached || (best != unreached && topForward + topBackward >= best)) {
+                break;
+            }
+            if ((nSettled & 1023) == 0 && !allowedTime.isInfinity() && std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= allowedTime.getValue()) {
+                throw OutOfTime("L'exploration s'est achevée par manque de temps");
+            }
+            nSettled++;
+
+            // On avance la recherche dont la file est la plus petite
+            if (forward.queue.size() <= backward.queue.size()) {
+                const std::size_t state = forward.queue.top().second;
+                forward.queue.pop();
+                forward.settled[state] = true;
+                const unsigned int u = static_cast<unsigned int>(state / 4), reached = static_cast<unsigned int>(state % 4);
+                if (reached == bothPlayers) {
+                    meet(state);
+                    continue;
+                }
+                for (std::size_t e = compact.beginEdges(u) ; e < compact.endEdges(u) ; e++) {
+                    const unsigned int w = compact.getSuccessor(e);
+                    const std::size_t next = std::size_t(w) * 4 + (reached | targets(w));
+                    forward.relax(next, topForward + edgeCost(compact, e, reached), state, e);
+                    meet(next);
+                }
+            }
+            else {
+                const std::size_t state = backward.queue.top().second;
+                backward.queue.pop();
+                backward.settled[state] = true;
+                const unsigned int v = static_cast<unsigned int>(state / 4), reachedAfter = static_cast<unsigned int>(state % 4);
+                // Les états (u, reached) dont un arc mène à state : reached contient ce que v n'apporte pas
+                const unsigned int required = reachedAfter & ~targets(v), optional = reachedAfter & targets(v);
+                for (std::size_t i = reverseOffsets[v] ; i < reverseOffsets[v + 1] ; i++) {
+                    const std::size_t e = reverseEdges[i];
+                    const unsigned int u = sources[i];
+                    for (unsigned int subset = optional ; ; subset = (subset - 1) & optional) {
+                        const unsigned int reached = required | subset;
+                        if (reached != bothPlayers && (reached & targets(u)) == targets(u)) {
+                            const std::size_t previous = std::size_t(u) * 4 + reached;
+                            backward.relax(previous, topBackward + edgeCost(compact, e, reached), state, e);
+                            meet(previous);
+                        }
+                        if (subset == 0) {
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (statistics) {
+            statistics->settled = nSettled;
+            statistics->usedFallback = false;
+        }
+        if (meeting == none) {
+            // Aucun chemin ne fait voir leur cible aux deux joueurs
+            return fallback(game, allowedTime, start, statistics);
+        }
+
+        // On recolle les deux moitiés du chemin
+        std::vector<unsigned int> steps;
+        for (std::size_t state = meeting ; state != none ; state = forward.previous[state]) {
+            steps.push_back(static_cast<unsigned int>(state / 4));
+        }
+        std::reverse(steps.begin(), steps.end());
+        for (std::size_t state = backward.previous[meeting] ; state != none ; state = backward.previous[state]) {
+            steps.push_back(static_cast<unsigned int>(state / 4));
+        }
+
+        Path path(game, vertices[steps[0]]);
+        for (std::size_t i = 1 ; i < steps.size() ; i++) {
+            path.addStep(vertices[steps[i]]);
+        }
+        if (path.isANashEquilibrium()) {
+            return path;
+        }
+        return fallback(game, allowedTime, start, statistics);
+    }
+}
\ No newline at end of file
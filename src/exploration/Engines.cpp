@@ -0,0 +1,83 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "exploration/Engines.hpp"
+
+#include <stdexcept>
+
+#include "exploration/BeamSearch.hpp"
+#include "exploration/BestFirstSearch.hpp"
+#include "exploration/BidirectionalSearch.hpp"
+#include "exploration/ForcedChains.hpp"
+#include "exploration/Heuristics.hpp"
+#include "exploration/PatternDatabase.hpp"
+#include "exploration/RandomPaths.hpp"
+
+namespace exploration {
+    const std::map<std::string, engineSignature>& engines() {
+        static const std::map<std::string, engineSignature> registry = {
+            // A* avec l'heuristique positive, sur le jeu dont les chaînes de coups forcés sont contractées
+            {"astar", [](ReachabilityGame &game, const EngineOptions &options) {
+                return searchContracted(game, options.allowedTime, [&](const ReachabilityGame &contracted, types::Long allowedTime) {
+                    return bestFirstSearch(contracted, heuristics::AStarPositive(contracted), allowedTime, nullptr, options.tieBreaking, options.symmetries);
+                });
+            }},
+            // A* avec l'heuristique positive renforcée par une base de motifs sur les paires de joueurs (l'heuristique positive seule si un poids est négatif)
+            {"patterns", [](ReachabilityGame &game, const EngineOptions &options) {
+                return searchContracted(game, options.allowedTime, [&](const ReachabilityGame &contracted, types::Long allowedTime) {
+                    if (!contracted.hasNonNegativeWeights()) {
+                        return bestFirstSearch(contracted, heuristics::AStarPositive(contracted), allowedTime, nullptr, options.tieBreaking, options.symmetries);
+                    }
+                    const PatternDatabase database = options.patternsFile.empty() ? PatternDatabase(contracted) : PatternDatabase::loadOrBuild(contracted, options.patternsFile);
+                    return bestFirstSearch(contracted, heuristics::PairPatterns(contracted, database), allowedTime, nullptr, options.tieBreaking, options.symmetries);
+                });
+            }},
+            // Exploration par coût uniforme : la priorité est g(n) seul, sans estimation du coût restant
+            {"uniform", [](ReachabilityGame &game, const EngineOptions &options) {
+                return searchContracted(game, options.allowedTime, [&](const ReachabilityGame &contracted, types::Long allowedTime) {
+                    return bestFirstSearch(contracted, heuristics::Zero(), allowedTime, nullptr, options.tieBreaking, options.symmetries);
+                });
+            }},
+            // Chemins aléatoires
+            {"random", [](ReachabilityGame &game, const EngineOptions &options) {
+                return parallelRandomPath(game, options.nPaths, options.allowedTime, options.nThreads);
+            }},
+            // Chemins aléatoires guidés vers les cibles
+            {"guided", [](ReachabilityGame &game, const EngineOptions &options) {
+                return guidedRandomPath(game, options.nPaths, options.allowedTime, options.nThreads);
+            }},
+            // Recherche bidirectionnelle pour les jeux à deux joueurs
+            {"bidirectional", [](ReachabilityGame &game, const EngineOptions &options) {
+                return bidirectionalSearch(game, options.allowedTime);
+            }},
+            // Recherche en faisceau avec l'heuristique positive
+            {"beam", [](ReachabilityGame &game, const EngineOptions &options) {
+                return beamSearch(game, heuristics::AStarPositive(game), options.beamWidth, options.allowedTime, options.nThreads);
+            }},
+        };
+        return registry;
+    }
+
+    const engineSignature& findEngine(const std::string &name) {
+        auto itr = engines().find(name);
+        if (itr == engines().end()) {
+            throw std::runtime_error("findEngine: moteur inconnu : " + name);
+        }
+        return itr->second;
+    }
+}
\ No newline at end of file
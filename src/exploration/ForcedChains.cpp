@@ -0,0 +1,180 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "exploration/ForcedChains.hpp"
+
+using namespace types;
+
+namespace exploration {
+    namespace {
+        bool isForced(const Vertex &vertex) {
+            return vertex.getNumberSuccessors() == 1 && vertex.getTargetPlayers().empty();
+        }
+
+        std::uint64_t chainKey(unsigned int from, unsigned int to) {
+            return (std::uint64_t(from) << 32) | to;
+        }
+    }
+
+    ForcedChains::ForcedChains(const ReachabilityGame &game) :
+        m_original(game)
+        {
+        const std::vector<Vertex::Ptr> &vertices = game.getGraph().getVertices();
+        const std::size_t size = vertices.size();
+        const std::size_t nPlayers = game.getPlayers().size();
+
+        std::vector<bool> kept(size);
+        for (const Vertex::Ptr &vertex : vertices) {
+            kept[vertex->getID()] = !isForced(*vertex);
+        }
+        kept[game.getInit()->getID()] = true;
+
+        // Un cycle formé uniquement de sommets forcés garde un de ses sommets : sinon, sa chaîne ne finirait pas
+        std::vector<char> walked(size, 0);
+        std::vector<unsigned int> walk;
+        for (unsigned int v = 0 ; v < size ; v++) {
+            unsigned int x = v;
+            walk.clear();
+            while (!kept[x] && walked[x] == 0) {
+                walked[x] = 1;
+                walk.push_back(x);
+                x = vertices[x]->cbegin()->first;
+            }
+            if (!kept[x] && walked[x] == 1) {
+                kept[x] = true;
+            }
+            for (unsigned int w : walk) {
+                walked[w] = 2;
+            }
+        }
+
+        // On suit les chaînes depuis chaque sommet gardé. Si deux arcs d'un même sommet mènent au même sommet, on garde le premier sommet d'une des chaînes et on recommence
+        struct MacroEdge {
+            unsigned int to;
+            std::vector<Long> weights;
+            std::vector<unsigned int> chain;
+        };
+        std::vector<std::vector<MacroEdge>> edges(size);
+        bool collision = true;
+        while (collision) {
+            collision = false;
+            for (unsigned int u = 0 ; u < size && !collision ; u++) {
+                edges[u].clear();
+                if (!kept[u]) {
+                    continue;
+                }
+                std::unordered_map<unsigned int, std::size_t> seen;
+                for (auto succ = vertices[u]->cbegin() ; succ != vertices[u]->cend() ; ++succ) {
+                    MacroEdge edge{succ->first, succ->second.second, {}};
+                    while (!kept[edge.to]) {
+                        edge.chain.push_back(edge.to);
+                        auto next = vertices[edge.to]->cbegin();
+                        for (std::size_t p = 0 ; p < nPlayers ; p++) {
+                            edge.weights[p] += next->second.second[p];
+                        }
+                        edge.to = next->first;
+                    }
+
+                    auto previous = seen.find(edge.to);
+                    if (previous != seen.end()) {
+                        const MacroEdge &other = edges[u][previous->second];
+                        kept[edge.chain.empty() ? other.chain.front() : edge.chain.front()] = true;
+                        collision = true;
+                        break;
+                    }
+                    seen.emplace(edge.to, edges[u].size());
+                    edges[u].push_back(std::move(edge));
+                }
+            }
+        }
+
+        std::vector<unsigned int> newIDs(size);
+        for (unsigned int v = 0 ; v < size ; v++) {
+            if (kept[v]) {
+                newIDs[v] = m_originalIDs.size();
+                m_originalIDs.push_back(v);
+            }
+        }
+        if (m_originalIDs.size() == size) {
+            m_originalIDs.clear();
+            return;
+        }
+
+        // On construit le jeu contracté
+        std::vector<Vertex::Ptr> contracted;
+        std::vector<Player> players;
+        for (unsigned int p = 0 ; p < nPlayers ; p++) {
+            players.emplace_back(p);
+        }
+        for (unsigned int original : m_originalIDs) {
+            const Vertex::Ptr &vertex = vertices[original];
+            contracted.push_back(std::make_shared<Vertex>(contracted.size(), vertex->getPlayer(), nPlayers));
+            players[vertex->getPlayer()].addVertex(contracted.back());
+            for (unsigned int p : vertex->getTargetPlayers()) {
+                players[p].addGoal(contracted.back());
+            }
+        }
+        for (unsigned int original : m_originalIDs) {
+            const unsigned int from = newIDs[original];
+            for (MacroEdge &edge : edges[original]) {
+                const unsigned int to = newIDs[edge.to];
+                contracted[from]->addSuccessor(contracted[to], edge.weights);
+                if (!edge.chain.empty()) {
+                    m_chains.emplace(chainKey(from, to), std::move(edge.chain));
+                }
+            }
+        }
+        m_contracted = std::make_unique<ReachabilityGame>(Graph(contracted, nPlayers), contracted[newIDs[game.getInit()->getID()]], players);
+    }
+
+    bool ForcedChains::empty() const {
+        return !m_contracted;
+    }
+
+    std::size_t ForcedChains::getNumberRemoved() const {
+        return empty() ? 0 : m_original.getGraph().size() - m_originalIDs.size();
+    }
+
+    const ReachabilityGame& ForcedChains::getGame() const {
+        return empty() ? m_original : *m_contracted;
+    }
+
+    Path ForcedChains::expand(const Path &path) const {
+        if (empty()) {
+            return path;
+        }
+
+        const std::vector<Vertex::Ptr> &vertices = m_original.getGraph().getVertices();
+        auto step = path.getSteps().cbegin();
+        Path expanded(m_original, vertices[m_originalIDs[(*step)->getID()]]);
+        unsigned int previous = (*step)->getID();
+        for (++step ; step != path.getSteps().cend() ; ++step) {
+            const unsigned int current = (*step)->getID();
+            auto chain = m_chains.find(chainKey(previous, current));
+            if (chain != m_chains.end()) {
+                for (unsigned int original : chain->second) {
+                    expanded.addStep(vertices[original]);
+                }
+            }
+            expanded.addStep(vertices[m_originalIDs[current]]);
+            previous = current;
+        }
+        return expanded;
+    }
+}
\ No newline at end of file
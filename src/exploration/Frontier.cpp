@@ -0,0 +1,101 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "exploration/Frontier.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "exploration/Heuristics.hpp"
+
+using namespace types;
+
+namespace exploration {
+    namespace {
+        /**
+         * \brief Vrai si b doit sortir avant a (std::push_heap garde au sommet le plus grand)
+         */
+        template <typename Entry>
+        bool after(const Entry &a, const Entry &b) {
+            if (a.key != b.key) {
+                return a.key > b.key;
+            }
+            if (a.depth != b.depth) {
+                return a.depth < b.depth;
+            }
+            return a.order > b.order;
+        }
+    }
+
+    TieBreaking parseTieBreaking(const std::string &name) {
+        if (name == "depth") {
+            return TieBreaking::Deepest;
+        }
+        else if (name == "reached") {
+            return TieBreaking::MostReached;
+        }
+        else if (name == "h") {
+            return TieBreaking::LowestHeuristic;
+        }
+        throw std::runtime_error("parseTieBreaking: règle inconnue : " + name);
+    }
+
+    Frontier::Frontier(TieBreaking tieBreaking) :
+        m_tieBreaking(tieBreaking),
+        m_size(0),
+        m_order(0) {
+    }
+
+    void Frontier::push(const Node::Ptr &node) {
+        std::vector<Entry> &bucket = m_buckets[node->pathCost];
+        bucket.push_back(Entry{tieKey(*node), node->path.size(), m_order++, node});
+        std::push_heap(bucket.begin(), bucket.end(), after<Entry>);
+        m_size++;
+    }
+
+    Node::Ptr Frontier::pop() {
+        auto first = m_buckets.begin();
+        std::vector<Entry> &bucket = first->second;
+        std::pop_heap(bucket.begin(), bucket.end(), after<Entry>);
+        Node::Ptr node = std::move(bucket.back().node);
+        bucket.pop_back();
+        if (bucket.empty()) {
+            m_buckets.erase(first);
+        }
+        m_size--;
+        return node;
+    }
+
+    long Frontier::tieKey(const Node &node) const {
+        switch (m_tieBreaking) {
+        case TieBreaking::MostReached:
+            return node.state.notVisitedPlayers.size();
+        case TieBreaking::LowestHeuristic: {
+            const Long h = node.pathCost - heuristics::accumulatedCost(node);
+            if (h.isInfinity()) {
+                return h > 0 ? std::numeric_limits<long>::max() : std::numeric_limits<long>::min();
+            }
+            return h.getValue();
+        }
+        default:
+            return 0;
+        }
+    }
+}
\ No newline at end of file
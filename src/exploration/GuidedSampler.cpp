@@ -0,0 +1,81 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "exploration/GuidedSampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+namespace exploration {
+    GuidedSampler::GuidedSampler(const ReachabilityGame &game, const CompactGame &compact, double temperature, double exploration) :
+        m_compact(compact),
+        m_distances(game.getTargetDistances()),
+        m_probabilities(compact.getNumberPlayers() * compact.getNumberEdges()),
+        m_aliases(compact.getNumberPlayers() * compact.getNumberEdges())
+        {
+        const std::size_t nVertices = compact.size(), nEdges = compact.getNumberEdges(), nPlayers = compact.getNumberPlayers();
+
+        std::vector<double> scores, weights;
+        for (unsigned int p = 0 ; p < nPlayers ; p++) {
+            const types::Long* playerDistances = m_distances.data() + p * nVertices;
+            for (unsigned int v = 0 ; v < nVertices ; v++) {
+                const std::size_t begin = compact.beginEdges(v), degree = compact.getNumberSuccessors(v);
+                if (degree <= 1) {
+                    continue;
+                }
+
+                scores.assign(degree, std::numeric_limits<double>::infinity());
+                double best = std::numeric_limits<double>::infinity();
+                bool unbounded = false;
+                for (std::size_t i = 0 ; i < degree ; i++) {
+                    const std::size_t e = begin + i;
+                    const types::Long &distance = playerDistances[compact.getSuccessor(e)];
+                    if (distance == -types::Long::infinity) {
+                        // Le successeur mène à un cycle négatif : seuls ces arcs gardent le poids du softmin
+                        if (!unbounded) {
+                            unbounded = true;
+                            std::fill(scores.begin(), scores.begin() + i, std::numeric_limits<double>::infinity());
+                        }
+                        scores[i] = best = 0;
+                    }
+                    else if (!unbounded && !distance.isInfinity()) {
+                        scores[i] = double(compact.getWeights(e)[p]) + double(distance.getValue());
+                        best = std::min(best, scores[i]);
+                    }
+                }
+
+                weights.assign(degree, 1.);
+                if (best != std::numeric_limits<double>::infinity()) {
+                    double total = 0;
+                    for (std::size_t i = 0 ; i < degree ; i++) {
+                        weights[i] = scores[i] == std::numeric_limits<double>::infinity() ? 0. : std::exp(-(scores[i] - best) / temperature);
+                        total += weights[i];
+                    }
+                    for (std::size_t i = 0 ; i < degree ; i++) {
+                        weights[i] = (1. - exploration) * weights[i] / total + exploration / double(degree);
+                    }
+                }
+
+                const std::size_t table = p * nEdges + begin;
+                types::aliasTable::build(weights.data(), degree, m_probabilities.data() + table, m_aliases.data() + table);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "exploration/PatternDatabase.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+
+using namespace types;
+
+namespace exploration {
+    namespace {
+        const char magic[8] = {'R', 'G', 'A', 'M', 'E', 'P', 'D', 'B'};
+        const std::uint32_t version = 1;
+        const std::uint32_t endiannessMarker = 0x01020304;
+
+        /**
+         * \brief L'en-tête d'un fichier de base de motifs, suivi des valeurs (int64, nPairs * nVertices)
+         */
+        struct Header {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t endianness;
+            std::uint64_t nVertices;
+            std::uint64_t nPlayers;
+            std::uint64_t fingerprint;
+            std::uint64_t nValues;
+        };
+
+        typedef std::unique_ptr<std::FILE, int(*)(std::FILE*)> File;
+
+        File open(const std::string &path, const char* mode) {
+            return File(std::fopen(path.c_str(), mode), &std::fclose);
+        }
+
+        /**
+         * \brief Ajoute une valeur à une empreinte FNV-1a
+         */
+        void mix(std::uint64_t &hash, std::uint64_t value) {
+            for (int i = 0 ; i < 8 ; i++) {
+                hash ^= (value >> (8 * i)) & 0xFF;
+                hash *= 0x100000001B3ULL;
+            }
+        }
+
+        /**
+         * \brief Calcule l'empreinte d'un jeu : sommet initial, propriétaires, cibles, arcs et poids
+         */
+        std::uint64_t fingerprint(const ReachabilityGame &game) {
+            const std::size_t nPlayers = game.getPlayers().size();
+            std::uint64_t hash = 0xCBF29CE484222325ULL;
+            mix(hash, game.getGraph().size());
+            mix(hash, nPlayers);
+            mix(hash, game.getInit()->getID());
+            for (const Vertex::Ptr &vertex : game.getGraph().getVertices()) {
+                mix(hash, vertex->getPlayer());
+                for (unsigned int p = 0 ; p < nPlayers ; p++) {
+                    mix(hash, vertex->isTargetFor(p));
+                }
+                for (auto succ = vertex->cbegin() ; succ != vertex->cend() ; ++succ) {
+                    mix(hash, succ->second.first.lock()->getID());
+                    for (unsigned int p = 0 ; p < nPlayers ; p++) {
+                        mix(hash, std::uint64_t(succ->second.second[p].getValue()));
+                    }
+                }
+            }
+            return hash;
+        }
+    }
+
+    const std::int64_t PatternDatabase::unreachable = std::numeric_limits<std::int64_t>::max();
+
+    PatternDatabase::PatternDatabase(const ReachabilityGame &game) :
+        m_size(game.getGraph().size()),
+        m_nPlayers(game.getPlayers().size()),
+        m_fingerprint(fingerprint(game)),
+        m_joint(m_nPlayers * (m_nPlayers - 1) / 2 * m_size, unreachable)
+        {
+        if (!game.hasNonNegativeWeights()) {
+            // Le Dijkstra par paire ne termine pas sur un cycle négatif
+            throw std::runtime_error("PatternDatabase: les poids doivent être positifs");
+        }
+        const auto &vertices = game.getGraph().getVertices();
+        const std::vector<Long> &distances = game.getTargetDistances();
+
+        typedef std::pair<std::int64_t, unsigned int> Entry;
+        for (unsigned int i = 0 ; i < m_nPlayers ; i++) {
+            for (unsigned int j = i + 1 ; j < m_nPlayers ; j++) {
+                std::int64_t* joint = m_joint.data() + pairIndex(i, j) * m_size;
+                std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+
+                // Sur une cible de i ou de j, au moins un des deux joueurs a fini : il ne reste que la distance de l'autre
+                for (unsigned int v = 0 ; v < m_size ; v++) {
+                    const bool forI = vertices[v]->isTargetFor(i), forJ = vertices[v]->isTargetFor(j);
+                    if (!forI && !forJ) {
+                        continue;
+                    }
+                    const Long rest = forI && forJ ? Long(0) : (forI ? distances[j * m_size + v] : distances[i * m_size + v]);
+                    if (rest != Long::infinity) {
+                        joint[v] = rest.getValue();
+                        queue.emplace(joint[v], v);
+                    }
+                }
+
+                // Ailleurs, les deux joueurs paient chaque arc jusqu'à la prochaine cible
+                while (!queue.empty()) {
+                    const Entry top = queue.top();
+                    queue.pop();
+                    if (joint[top.second] < top.first) {
+                        // Entrée périmée : le sommet a déjà été fixé avec un coût plus petit
+                        continue;
+                    }
+                    const Vertex::Ptr &vertex = vertices[top.second];
+                    for (auto pred = vertex->beginPredecessors() ; pred != vertex->endPredecessors() ; ++pred) {
+                        const Vertex::Ptr &from = vertices[pred->first];
+                        if (from->isTargetFor(i) || from->isTargetFor(j)) {
+                            continue;
+                        }
+                        const std::int64_t candidate = top.first + pred->second.second[i].getValue() + pred->second.second[j].getValue();
+                        if (candidate < joint[pred->first]) {
+                            joint[pred->first] = candidate;
+                            queue.emplace(candidate, pred->first);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    PatternDatabase PatternDatabase::load(const ReachabilityGame &game, const std::string &path) {
+        File file = open(path, "rb");
+        if (!file) {
+            throw std::runtime_error("PatternDatabase: impossible d'ouvrir " + path);
+        }
+
+        Header header;
+        if (std::fread(&header, sizeof(header), 1, file.get()) != 1 || std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+            throw std::runtime_error("PatternDatabase: " + path + " n'est pas une base de motifs");
+        }
+        if (header.version != version) {
+            throw std::runtime_error("PatternDatabase: version du format non supportée");
+        }
+        if (header.endianness != endiannessMarker) {
+            throw std::runtime_error("PatternDatabase: le fichier a été écrit sur une machine d'un autre ordre des octets");
+        }
+
+        PatternDatabase database;
+        database.m_size = game.getGraph().size();
+        database.m_nPlayers = game.getPlayers().size();
+        database.m_fingerprint = fingerprint(game);
+        if (header.nVertices != database.m_size || header.nPlayers != database.m_nPlayers || header.fingerprint != database.m_fingerprint || header.nValues != database.m_nPlayers * (database.m_nPlayers - 1) / 2 * database.m_size) {
+            throw std::runtime_error("PatternDatabase: " + path + " a été calculé pour un autre jeu");
+        }
+
+        database.m_joint.resize(header.nValues);
+        if (std::fread(database.m_joint.data(), sizeof(std::int64_t), header.nValues, file.get()) != header.nValues) {
+            throw std::runtime_error("PatternDatabase: " + path + " est tronqué");
+        }
+        return database;
+    }
+
+    PatternDatabase PatternDatabase::loadOrBuild(const ReachabilityGame &game, const std::string &path) {
+        if (open(path, "rb")) {
+            try {
+                return load(game, path);
+            }
+            catch (const std::runtime_error&) {
+                // Base illisible ou calculée pour un autre jeu : on la remplace
+            }
+        }
+        PatternDatabase database(game);
+        database.save(path);
+        return database;
+    }
+
+    void PatternDatabase::save(const std::string &path) const {
+        File file = open(path, "wb");
+        if (!file) {
+            throw std::runtime_error("PatternDatabase: impossible d'ouvrir " + path);
+        }
+
+        Header header;
+        std::memcpy(header.magic, magic, sizeof(magic));
+        header.version = version;
+        header.endianness = endiannessMarker;
+        header.nVertices = m_size;
+        header.nPlayers = m_nPlayers;
+        header.fingerprint = m_fingerprint;
+        header.nValues = m_joint.size();
+        if (std::fwrite(&header, sizeof(header), 1, file.get()) != 1 || std::fwrite(m_joint.data(), sizeof(std::int64_t), m_joint.size(), file.get()) != m_joint.size()) {
+            throw std::runtime_error("PatternDatabase: impossible d'écrire dans " + path);
+        }
+    }
+}
\ No newline at end of file
@@ -18,116 +18,176 @@
 
 #include "exploration/RandomPaths.hpp"
 
+#include <atomic>
 #include <random>
 #include <chrono>
 #include <vector>
 
+#include "CompactGame.hpp"
+#include "exploration/GuidedSampler.hpp"
+#include "exploration/RandomWalk.hpp"
+#include "types/ThreadPool.hpp"
+
 /**
- * \brief Génère aléatoirement un chemin de longueur donné
- * \param game Le jeu
- * \param length La longueur du chemin
+ * \brief Le meilleur équilibre de Nash vu jusqu'ici.
+ * 
+ * Un équilibre est meilleur qu'un autre s'il permet à plus de joueurs de voir leur cible ou, à nombre égal, si la somme des coûts de ces joueurs est plus petite. En cas d'égalité, le premier vu est gardé.
  */
-Path generatePath(const ReachabilityGame &game, std::size_t length) {
-    std::shared_ptr<const Vertex> current = game.getInit();
-    std::default_random_engine generator(std::chrono::system_clock::now().time_since_epoch().count());
+class BestEquilibrium {
+public:
+    BestEquilibrium() :
+        m_found(false),
+        m_nReached(0),
+        m_cost(0)
+        {
 
-    Path path(game, current);
+    }
 
-    while(length--) {
-        // On va tirer le successeur au hasard
-        std::uniform_int_distribution<std::size_t> successorChoice(0, current->getNumberSuccessors() - 1);
+    /**
+     * \brief Garde la marche si elle est meilleure que celle retenue
+     * \param walk Une marche qui est un équilibre de Nash
+     */
+    void offer(const exploration::RandomWalk &walk) {
+        long cost = 0;
+        for (std::size_t p = 0 ; p < walk.getCosts().size() ; p++) {
+            if (walk.hasReached(p)) {
+                cost += walk.getCosts()[p];
+            }
+        }
+        offer(walk.getVertices(), walk.getNumberReached(), cost);
+    }
 
-        std::size_t succIndex = successorChoice(generator);
+    /**
+     * \brief Garde l'équilibre de other s'il est meilleur que celui retenu
+     */
+    void merge(const BestEquilibrium &other) {
+        if (other.m_found) {
+            offer(other.m_vertices, other.m_nReached, other.m_cost);
+        }
+    }
 
-        std::shared_ptr<const Vertex> succ = nullptr;
+    bool found() const {
+        return m_found;
+    }
 
-        for (auto s = current->cbegin() ; s != current->cend() ; s++) {
-            if (succIndex-- == 0) {
-                succ = s->second.first.lock();
-                break;
-            }
-        }
+    const std::vector<unsigned int>& getVertices() const {
+        return m_vertices;
+    }
 
-        path.addStep(succ);
-        current = succ;
+private:
+    void offer(const std::vector<unsigned int> &vertices, std::size_t nReached, long cost) {
+        if (!m_found || nReached > m_nReached || (nReached == m_nReached && cost < m_cost)) {
+            // Seuls les sommets sont copiés ; le Path n'est construit qu'à la fin
+            m_vertices.assign(vertices.begin(), vertices.end());
+            m_found = true;
+            m_nReached = nReached;
+            m_cost = cost;
+        }
     }
 
-    return path;
-}
+private:
+    bool m_found;
+    std::vector<unsigned int> m_vertices;
+    std::size_t m_nReached;
+    long m_cost;
+};
 
 /**
- * \brief Retourne le meilleur EN parmi ceux donnés
- * \param paths L'ensemble des EN
- * \param nPlayers Le nombre de joueurs
+ * \brief Renvoie le meilleur équilibre ou lance l'exception adaptée si aucun n'a été trouvé
  */
-const Path& filterBest(const std::vector<Path> &paths, std::size_t nPlayers) {
-    std::size_t bestCostIndex = 0;
-    std::size_t bestReachedIndex = 0;
-    types::Long valueBestCost = types::Long::infinity;
-    types::Long valueBestReached = 0;
-    types::Long partialValueBestCost = types::Long::infinity;
-    bool allPlayersEN = false;
-
-    for (std::size_t i = 0 ; i < paths.size() ; i++) {
-        const Path &p = paths[i];
-        const auto &costs = p.getCosts();
-
-        types::Long sumCost = 0; // Les coûts totaux
-        types::Long partialCost = 0; // La somme de coûts pour les joueurs qui ont vu leur cible
-        std::size_t nReached = 0; // Le nombre de joueurs qui ont vu une cible
-        for (const auto &cost : costs) {
-            if (cost.first) {
-                nReached++;
-                partialCost += cost.second;
-            }
-            sumCost += cost.second;
+Path extractBest(const BestEquilibrium &best, const exploration::RandomWalk &walk, bool outOfTime) {
+    if (!best.found()) {
+        if (outOfTime) {
+            throw exploration::OutOfTime("La génération de chemins s'est achevée par manque de temps");
         }
+        throw exploration::NoENGenerated("Pas d'équilibre de Nash généré");
+    }
+    return walk.toPath(best.getVertices());
+}
 
-        if (nReached != nPlayers && valueBestCost > sumCost) {
-            // Tout le monde n'a pas vu une cible mais on a un coût inférieur à celui trouvé précédemment
-            bestCostIndex = i;
-            valueBestCost = sumCost;
+/**
+ * \brief Répartit la génération de nPaths marches sur plusieurs threads et garde le meilleur équilibre
+ * \param walkOnce walkOnce(walk, generator) génère une marche et indique si c'est un équilibre de Nash
+ */
+template<typename WalkOnce>
+Path sampleInParallel(const ReachabilityGame &game, const CompactGame &compact, std::size_t nPaths, types::Long allowedTime, std::size_t nThreads, unsigned int seed, WalkOnce walkOnce) {
+    types::ThreadPool pool(nThreads);
+    // Un générateur, une marche et un meilleur équilibre par thread : la mémoire ne dépend pas du nombre de chemins
+    std::vector<std::default_random_engine> generators;
+    std::vector<exploration::RandomWalk> walks;
+    generators.reserve(pool.size());
+    walks.reserve(pool.size());
+    for (std::size_t t = 0 ; t < pool.size() ; t++) {
+        std::seed_seq sequence{seed, static_cast<unsigned int>(t)};
+        generators.emplace_back(sequence);
+        walks.emplace_back(game, compact);
+    }
+    std::vector<BestEquilibrium> bests(pool.size());
+
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<bool> outOfTime(false);
+
+    types::parallelFor(pool, nPaths, [&](std::size_t, std::size_t t) {
+        if (outOfTime.load(std::memory_order_relaxed)) {
+            return;
         }
-        else if (valueBestReached < nReached) {
-            // On voit plus de monde qu'avant
-            bestReachedIndex = i;
-            valueBestReached = nReached;
-            if (nPlayers == nReached) {
-                // On a vu tout le monde
-                allPlayersEN = true;
-            }
+        if (!allowedTime.isInfinity() && std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= allowedTime.getValue()) {
+            outOfTime = true;
+            return;
         }
-        else if (valueBestReached == nReached && partialCost < partialValueBestCost) {
-            // On voit autant de monde que l'EN déjà retenu mais les coûts sont moindres
-            bestReachedIndex = i;
-            partialValueBestCost = partialCost;
+
+        if (walkOnce(walks[t], generators[t])) {
+            bests[t].offer(walks[t]);
         }
-    }
+    });
 
-    if (allPlayersEN) {
-        return paths[bestReachedIndex];
-    }
-    else {
-        return paths[bestCostIndex];
+    for (std::size_t t = 1 ; t < bests.size() ; t++) {
+        bests[0].merge(bests[t]);
     }
+    return extractBest(bests[0], walks[0], outOfTime);
 }
 
 namespace exploration {
     Path randomPath(const ReachabilityGame &game, std::size_t nPaths) {
-        std::vector<Path> paths;
-        paths.reserve(nPaths);
+        return randomPath(game, nPaths, types::Long::infinity);
+    }
+
+    Path randomPath(const ReachabilityGame &game, std::size_t nPaths, types::Long allowedTime) {
+        std::default_random_engine generator(std::chrono::system_clock::now().time_since_epoch().count());
+        const CompactGame compact = CompactGame::fromReachabilityGame(game);
+        RandomWalk walk(game, compact);
+        BestEquilibrium best;
+
+        const auto start = std::chrono::steady_clock::now();
+        bool outOfTime = false;
 
         for (std::size_t i = 0 ; i < nPaths ; i++) {
-            Path p = generatePath(game, game.getMaxLength());
-            if (p.isANashEquilibrium()) {
-                paths.push_back(p);
+            if (!allowedTime.isInfinity() && std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= allowedTime.getValue()) {
+                outOfTime = true;
+                break;
             }
-        }
 
-        if (paths.size() == 0) {
-            throw NoENGenerated("Pas d'équilibre de Nash généré");
+            if (walk.walkEquilibrium(game.getMaxLength(), generator)) {
+                best.offer(walk);
+            }
         }
 
-        return filterBest(paths, game.getMaxLength());
+        return extractBest(best, walk, outOfTime);
+    }
+
+    Path parallelRandomPath(const ReachabilityGame &game, std::size_t nPaths, types::Long allowedTime, std::size_t nThreads, unsigned int seed) {
+        const CompactGame compact = CompactGame::fromReachabilityGame(game);
+        return sampleInParallel(game, compact, nPaths, allowedTime, nThreads, seed, [&game](RandomWalk &walk, std::default_random_engine &generator) {
+            return walk.walkEquilibrium(game.getMaxLength(), generator);
+        });
+    }
+
+    Path guidedRandomPath(const ReachabilityGame &game, std::size_t nPaths, types::Long allowedTime, std::size_t nThreads, unsigned int seed, double temperature) {
+        const CompactGame compact = CompactGame::fromReachabilityGame(game);
+        // Les tables ne sont que lues pendant les marches : tous les threads les partagent
+        const GuidedSampler sampler(game, compact, temperature);
+        return sampleInParallel(game, compact, nPaths, allowedTime, nThreads, seed, [&game, &sampler](RandomWalk &walk, std::default_random_engine &generator) {
+            return walk.walkEquilibrium(game.getMaxLength(), sampler, generator);
+        });
     }
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "exploration/RandomWalk.hpp"
+
+#include <algorithm>
+
+namespace exploration {
+    RandomWalk::RandomWalk(const ReachabilityGame &game, const CompactGame &compact) :
+        m_game(game),
+        m_compact(compact),
+        m_targetWords(CompactGame::targetWords(compact.getNumberPlayers())),
+        m_coalitionValues(compact.getNumberPlayers(), nullptr),
+        m_costs(compact.getNumberPlayers(), 0),
+        m_reached(compact.getNumberPlayers(), false),
+        m_nReached(0),
+        m_bounds(compact.getNumberPlayers()),
+        m_nonNegative(std::all_of(compact.getWeights(), compact.getWeights() + compact.getNumberEdges() * compact.getNumberPlayers(), [](long w) { return w >= 0; }))
+        {
+        const std::size_t capacity = game.getMaxLength() + 1;
+        m_vertices.reserve(capacity);
+        m_edges.reserve(capacity);
+    }
+
+    void RandomWalk::loadCoalitionValues() const {
+        // Les valeurs de coalition sont gardées par le jeu ; on garde seulement un pointeur vers elles
+        for (std::size_t p = 0 ; p < m_coalitionValues.size() ; p++) {
+            if (m_coalitionValues[p] == nullptr) {
+                m_coalitionValues[p] = &m_game.getCoalitionValues(p);
+            }
+        }
+    }
+
+    void RandomWalk::start() {
+        m_vertices.clear();
+        m_edges.clear();
+        std::fill(m_costs.begin(), m_costs.end(), 0);
+        std::fill(m_reached.begin(), m_reached.end(), false);
+        m_nReached = 0;
+
+        m_vertices.push_back(m_compact.getInit());
+        markTargets(m_compact.getInit());
+    }
+
+    bool RandomWalk::isANashEquilibrium() const {
+        const std::size_t nPlayers = m_costs.size();
+        std::vector<long> epsilon(nPlayers, 0); // Poids de la marche jusqu'au sommet courant
+        std::vector<char> visited(nPlayers, false); // Les joueurs qui ont déjà vu une cible
+
+        for (std::size_t i = 0 ; i < m_vertices.size() ; i++) {
+            const unsigned int current = m_vertices[i];
+            const std::uint64_t* targets = m_compact.getTargets() + current * m_targetWords;
+            for (std::size_t p = 0 ; p < nPlayers ; p++) {
+                if ((targets[p / 64] >> (p % 64)) & 1) {
+                    visited[p] = true;
+                }
+            }
+
+            if (i != 0) {
+                const long* weights = m_compact.getWeights(m_edges[i - 1]);
+                for (std::size_t p = 0 ; p < nPlayers ; p++) {
+                    epsilon[p] += weights[p];
+                }
+            }
+
+            const unsigned int player = m_compact.getPlayer(current);
+            if (!visited[player]) {
+                if (m_coalitionValues[player] == nullptr) {
+                    m_coalitionValues[player] = &m_game.getCoalitionValues(player);
+                }
+                if ((*m_coalitionValues[player])[current] + epsilon[player] < m_costs[player]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    Path RandomWalk::toPath(const std::vector<unsigned int> &vertices) const {
+        const auto &graphVertices = m_game.getGraph().getVertices();
+        Path path(m_game, graphVertices[vertices[0]]);
+        for (std::size_t i = 1 ; i < vertices.size() ; i++) {
+            path.addStep(graphVertices[vertices[i]]);
+        }
+        return path;
+    }
+}
\ No newline at end of file
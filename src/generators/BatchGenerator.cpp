@@ -0,0 +1,64 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "generators/BatchGenerator.hpp"
+
+#include <memory>
+
+#include "types/ThreadPool.hpp"
+
+/**
+ * \brief La fonction de mélange de SplitMix64
+ * \param x La valeur à mélanger
+ */
+std::uint64_t splitMix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+namespace generators {
+    std::uint64_t streamSeed(std::uint64_t masterSeed, std::uint64_t index) {
+        // La graine maîtresse choisit la "clé" et l'index est le compteur
+        return splitMix64(splitMix64(masterSeed) + index * 0x9E3779B97F4A7C15ULL);
+    }
+
+    std::default_random_engine streamEngine(std::uint64_t masterSeed, std::uint64_t index) {
+        std::uint64_t seed = streamSeed(masterSeed, index);
+        std::seed_seq sequence{std::uint32_t(seed), std::uint32_t(seed >> 32)};
+        return std::default_random_engine(sequence);
+    }
+
+    std::vector<ReachabilityGame> batchGenerator(std::size_t nGames, std::uint64_t masterSeed, const gameGeneratorSignature &generate, std::size_t nThreads) {
+        // ReachabilityGame n'a pas de constructeur par défaut : chaque thread remplit sa case
+        std::vector<std::unique_ptr<ReachabilityGame>> slots(nGames);
+
+        types::parallelFor(nThreads, nGames, [&](std::size_t i, std::size_t) {
+            std::default_random_engine generator = streamEngine(masterSeed, i);
+            slots[i] = std::make_unique<ReachabilityGame>(generate(generator));
+        });
+
+        std::vector<ReachabilityGame> games;
+        games.reserve(nGames);
+        for (auto &game : slots) {
+            games.push_back(std::move(*game));
+        }
+        return games;
+    }
+}
\ No newline at end of file
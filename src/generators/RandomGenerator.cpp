@@ -47,6 +47,11 @@ namespace generators {
     }
 
     ReachabilityGame randomGenerator(std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets) {
+        std::default_random_engine generator(std::chrono::system_clock::now().time_since_epoch().count());
+        return randomGenerator(size, lowOutgoing, upOutgoing, minWeight, maxWeight, multipleWeights, nPlayers, sharedTargets, probaPlayers, probaTargets, maximumTargets, generator);
+    }
+
+    ReachabilityGame randomGenerator(std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets, std::default_random_engine &generator) {
         if (probaPlayers.size() != nPlayers || probaTargets.size() != nPlayers || maximumTargets.size() != nPlayers) {
             throw std::runtime_error("randomGenerator: les tableaux de probabilité doivent arriver une taille identique au nombre de joueurs");
         }
@@ -67,7 +72,6 @@ namespace generators {
         }
 
         // On crée les générateurs aléatoires qui seront utilisés
-        std::default_random_engine generator(std::chrono::system_clock::now().time_since_epoch().count());
         std::discrete_distribution<std::size_t> playersDistribution(probaPlayers.begin(), probaPlayers.end()); // Sommet appartient au joueur i; i est tiré aléatoirement selon probaPlayers
         std::vector<std::bernoulli_distribution> targetsDistributions; // Pour chaque joueur, probabilité qu'un sommet soit une cible
         std::uniform_int_distribution<std::size_t> numberOfNeighborsDistribution(lowOutgoing, upOutgoing); // Distribution pour le nombre d'arcs sortants
@@ -23,6 +23,7 @@
 
 #include "generators/RandomGenerator.hpp"
 #include "algorithms/Tarjan.hpp"
+#include "algorithms/IncrementalComponents.hpp"
 #include "generators/GenerateWeights.hpp"
 
 using namespace algorithms;
@@ -36,16 +37,23 @@ namespace generators {
     }
 
     ReachabilityGame randomStronglyConnectedGenerator(std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets) {
+        std::default_random_engine generator(std::chrono::system_clock::now().time_since_epoch().count());
+        return randomStronglyConnectedGenerator(size, lowOutgoing, upOutgoing, minWeight, maxWeight, multipleWeights, nPlayers, sharedTargets, probaPlayers, probaTargets, maximumTargets, generator);
+    }
+
+    ReachabilityGame randomStronglyConnectedGenerator(std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets, std::default_random_engine &generator) {
         // On commence par générer un jeu
-        const ReachabilityGame game = randomGenerator(size, lowOutgoing, upOutgoing, minWeight, maxWeight, multipleWeights, nPlayers, sharedTargets, probaPlayers, probaTargets, maximumTargets);
+        const ReachabilityGame game = randomGenerator(size, lowOutgoing, upOutgoing, minWeight, maxWeight, multipleWeights, nPlayers, sharedTargets, probaPlayers, probaTargets, maximumTargets, generator);
 
         // Et on va modifier le graphe
         Graph graph = game.getGraph();
         std::vector<Vertex::Ptr>& vertices = graph.getVertices();
         
-        stronglyConnectedComponents components = tarjan(graph);
+        // Les composantes sont maintenues de façon incrémentale : fusionner deux composantes ne demande pas de relancer Tarjan
+        IncrementalComponents components(tarjanIterative(graph));
+        // Le nombre de composantes lors du dernier appel à Tarjan
+        std::size_t lastTarjan = components.size();
 
-        std::default_random_engine generator(std::chrono::system_clock::now().time_since_epoch().count());
         auto weightDistribution = constructWeightDistribution(minWeight, maxWeight);
 
         // Tant que tout le graphe n'est pas qu'une seule composante, on va fusionner deux composantes (aléatoirement choisies) en une seule
@@ -57,51 +65,19 @@ namespace generators {
                 i = componentSelection(generator);
                 j = componentSelection(generator);
             }
-            
-            stronglyConnectedComponent a, b;
-            std::size_t k = 0;
-            for (const stronglyConnectedComponent &compo : components) {
-                if (k == i) {
-                    a = compo;
-                }
-                if (k == j) {
-                    b = compo;
-                }
-                k++;
-            }
+
+            const std::vector<unsigned int> &a = components.getComponent(i);
+            const std::vector<unsigned int> &b = components.getComponent(j);
 
             // On tire deux sommets dans a et deux sommets dans b
             std::uniform_int_distribution<std::size_t> vertexASelection(0, a.size() - 1);
             std::uniform_int_distribution<std::size_t> vertexBSelection(0, b.size() - 1);
 
-            // Les indices dans les ensembles A et B
-            std::size_t vA = vertexASelection(generator);
-            std::size_t uA = vertexASelection(generator);
-            std::size_t vB = vertexBSelection(generator);
-            std::size_t uB = vertexBSelection(generator);
-
             // On récupère les ID des sommets correspondants
-            unsigned int vAID = 0, uAID = 0, vBID = 0, uBID = 0;
-            k = 0;
-            for (unsigned int v : a) {
-                if (k == vA) {
-                    vAID = v;
-                }
-                if (k == uA) {
-                    uAID = v;
-                }
-                k++;
-            }
-            k = 0;
-            for (unsigned int v : b) {
-                if (k == vB) {
-                    vBID = v;
-                }
-                if (k == uB) {
-                    uBID = v;
-                }
-                k++;
-            }
+            unsigned int vAID = a[vertexASelection(generator)];
+            unsigned int uAID = a[vertexASelection(generator)];
+            unsigned int vBID = b[vertexBSelection(generator)];
+            unsigned int uBID = b[vertexBSelection(generator)];
 
             // On crée un lien vA->vB et uB->uA
             // Comme a et b sont des composantes fortement connexes, on obtient une plus grosse composante fortement connexe
@@ -112,7 +88,14 @@ namespace generators {
                 vertices[uBID]->addSuccessor(vertices[uAID], generateWeights(nPlayers, generator, weightDistribution, multipleWeights));
             }
 
-            components = algorithms::tarjan(graph);
+            components.merge(i, j);
+
+            // Les nouveaux arcs peuvent aussi fusionner des composantes qui se trouvent "entre" a et b.
+            // On resynchronise avec Tarjan à chaque fois que le nombre de composantes a été divisé par quatre, ce qui garde un coût total en O((V+E) log V)
+            if (components.size() > 1 && 4 * components.size() <= lastTarjan) {
+                components = IncrementalComponents(tarjanIterative(graph));
+                lastTarjan = components.size();
+            }
         }
 
         // On a créé de nouveaux arcs. On doit mettre à jour les poids maximaux
@@ -0,0 +1,378 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "generators/StreamingGenerators.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "algorithms/Tarjan.hpp"
+#include "algorithms/IncrementalComponents.hpp"
+#include "generators/GenerateWeights.hpp"
+
+using namespace types;
+
+namespace {
+    /**
+     * \brief Tire les poids d'un arc (un par joueur) dans weights
+     */
+    void drawWeights(std::vector<long> &weights, std::default_random_engine &generator, std::uniform_int_distribution<long> &weightDistribution, bool multipleWeights) {
+        if (multipleWeights) {
+            for (long &w : weights) {
+                w = weightDistribution(generator);
+            }
+        }
+        else {
+            std::fill(weights.begin(), weights.end(), weightDistribution(generator));
+        }
+    }
+
+    /**
+     * \brief Tire les joueurs et les cibles des sommets et les envoie au récepteur.
+     * 
+     * Les tirages sont faits de la même façon que dans les générateurs qui construisent des Vertex.
+     */
+    void drawPlayersAndTargets(GameSink &sink, std::size_t size, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<Long>& maximumTargets, std::default_random_engine &generator) {
+        std::discrete_distribution<std::size_t> playersDistribution(probaPlayers.begin(), probaPlayers.end());
+        std::vector<std::bernoulli_distribution> targetsDistributions;
+        for (std::size_t i = 0 ; i < nPlayers ; i++) {
+            targetsDistributions.emplace_back(probaTargets[i]);
+        }
+        std::uniform_int_distribution<std::size_t> forceTargetDistribution(0, size-1);
+        std::vector<std::size_t> numberTargets(nPlayers, 0);
+
+        for (std::size_t i = 0 ; i < size ; i++) {
+            sink.setPlayer(i, playersDistribution(generator));
+
+            for (std::size_t j = 0 ; j < nPlayers ; j++) {
+                if (maximumTargets[j] > Long(long(numberTargets[j])) && targetsDistributions[j](generator)) {
+                    sink.addTarget(i, j);
+                    numberTargets[j]++;
+
+                    if (!sharedTargets) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Chaque joueur doit avoir au moins une cible
+        for (std::size_t j = 0 ; j < nPlayers ; j++) {
+            if (numberTargets[j] == 0) {
+                sink.addTarget(forceTargetDistribution(generator), j);
+            }
+        }
+    }
+
+    /**
+     * \brief Tire k entiers distincts dans [0, n) (algorithme de Floyd).
+     * 
+     * Le coût est O(k), quel que soit n.
+     * \param chosen Un ensemble de travail (vidé par la fonction)
+     * \param result Les entiers tirés (vidé par la fonction)
+     */
+    void sampleDistinct(std::size_t n, std::size_t k, std::default_random_engine &generator, std::unordered_set<std::size_t> &chosen, std::vector<std::size_t> &result) {
+        chosen.clear();
+        result.clear();
+        for (std::size_t j = n - k ; j < n ; j++) {
+            std::size_t t = std::uniform_int_distribution<std::size_t>(0, j)(generator);
+            if (!chosen.insert(t).second) {
+                t = j;
+                chosen.insert(t);
+            }
+            result.push_back(t);
+        }
+    }
+
+    /**
+     * \brief Tire le nombre d'arcs d'un type donné parmi n candidats, chacun étant gardé avec la probabilité p
+     */
+    std::size_t drawCount(std::size_t n, double p, std::default_random_engine &generator) {
+        if (n == 0 || p <= 0) {
+            return 0;
+        }
+        if (p >= 1) {
+            return n;
+        }
+        return std::binomial_distribution<std::size_t>(n, p)(generator);
+    }
+
+    bool inUnitInterval(double d) {
+        return d >= -1E-15 && d <= 1 + 1E-15;
+    }
+}
+
+namespace generators {
+    void streamRandomGenerator(GameSink &sink, std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets, std::default_random_engine &generator) {
+        if (probaPlayers.size() != nPlayers || probaTargets.size() != nPlayers || maximumTargets.size() != nPlayers) {
+            throw std::runtime_error("streamRandomGenerator: les tableaux de probabilité doivent arriver une taille identique au nombre de joueurs");
+        }
+        if (lowOutgoing == 0 || upOutgoing == 0) {
+            throw std::runtime_error("streamRandomGenerator: les bornes sur le nombre de noeuds sortants doivent être > 0");
+        }
+        if (lowOutgoing > upOutgoing) {
+            throw std::runtime_error("streamRandomGenerator: la borne inférieure sur le nombre de noeuds sortants ne peut pas être supérieur à la borne supérieure");
+        }
+        if (lowOutgoing > size || upOutgoing > size) {
+            throw std::runtime_error("streamRandomGenerator: les bornes sur le nombre de noeuds sortants ne peuvent pas dépasser le nombre de noeuds");
+        }
+        if (minWeight > maxWeight) {
+            throw std::runtime_error("streamRandomGenerator: le poids minimal doit être inférieur ou égal au poids maximal");
+        }
+        if (std::abs(std::accumulate(probaPlayers.begin(), probaPlayers.end(), 0.) - 1.) > 1E-15) {
+            throw std::runtime_error("streamRandomGenerator: la somme des valeurs de probaPlayers doit être 1.");
+        }
+
+        std::uniform_int_distribution<std::size_t> numberOfNeighborsDistribution(lowOutgoing, upOutgoing);
+        std::uniform_int_distribution<std::size_t> neighborDistribution(0, size-1);
+        auto weightDistribution = constructWeightDistribution(minWeight, maxWeight);
+
+        sink.begin(size, nPlayers, 0);
+        drawPlayersAndTargets(sink, size, nPlayers, sharedTargets, probaPlayers, probaTargets, maximumTargets, generator);
+
+        std::vector<long> weights(nPlayers);
+        std::vector<unsigned int> neighbors;
+        neighbors.reserve(upOutgoing);
+        for (std::size_t i = 0 ; i < size ; i++) {
+            std::size_t e = numberOfNeighborsDistribution(generator);
+
+            neighbors.clear();
+            while (e-- > 0) {
+                // On ne veut pas avoir deux arcs i->u. Le nombre d'arcs sortants est petit : une recherche linéaire suffit
+                unsigned int u = neighborDistribution(generator);
+                while (std::find(neighbors.begin(), neighbors.end(), u) != neighbors.end()) {
+                    u = neighborDistribution(generator);
+                }
+                neighbors.push_back(u);
+
+                drawWeights(weights, generator, weightDistribution, multipleWeights);
+                sink.addEdge(i, u, weights.data());
+            }
+        }
+
+        sink.finish();
+    }
+
+    void streamRandomTreeLikeGenerator(GameSink &sink, std::size_t size, std::size_t lowBranchingFactor, std::size_t upBranchingFactor, double probaSelf, double probaSameDepth, double probaSkipping, double probaClimbing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double> &probaTargets, const std::vector<types::Long>& maximumTargets, std::default_random_engine &generator) {
+        if (probaPlayers.size() != nPlayers || probaTargets.size() != nPlayers || maximumTargets.size() != nPlayers) {
+            throw std::runtime_error("streamRandomTreeLikeGenerator: les tableaux de probabilité doivent arriver une taille identique au nombre de joueurs");
+        }
+        if (lowBranchingFactor == 0 || upBranchingFactor == 0) {
+            throw std::runtime_error("streamRandomTreeLikeGenerator: les bornes sur le facteur de branchement doivent être > 0");
+        }
+        if (lowBranchingFactor > upBranchingFactor) {
+            throw std::runtime_error("streamRandomTreeLikeGenerator: la borne inférieure sur le facteur de branchement ne peut pas être supérieur à la borne supérieure");
+        }
+        if (lowBranchingFactor > size || upBranchingFactor > size) {
+            throw std::runtime_error("streamRandomTreeLikeGenerator: les bornes sur le facteur de branchement ne peuvent pas dépasser le nombre de noeuds");
+        }
+        if (minWeight > maxWeight) {
+            throw std::runtime_error("streamRandomTreeLikeGenerator: le poids minimal doit être inférieur ou égal au poids maximal");
+        }
+        if (std::abs(std::accumulate(probaPlayers.begin(), probaPlayers.end(), 0.) - 1.) > 1E-15) {
+            throw std::runtime_error("streamRandomTreeLikeGenerator: la somme des valeurs de probaPlayers doit être 1");
+        }
+        if (!inUnitInterval(probaSelf) || !inUnitInterval(probaSameDepth) || !inUnitInterval(probaSkipping) || !inUnitInterval(probaClimbing)) {
+            throw std::runtime_error("streamRandomTreeLikeGenerator: probaSelf, probaSameDepth, probaSkipping et probaClimbing doivent être dans [0, 1]");
+        }
+        for (double d : probaTargets) {
+            if (!inUnitInterval(d)) {
+                throw std::runtime_error("streamRandomTreeLikeGenerator: les probabilités dans probaTargets doivent être dans [0, 1]");
+            }
+        }
+
+        std::uniform_int_distribution<std::size_t> branchingFactorDistribution(lowBranchingFactor, upBranchingFactor);
+        auto weightDistribution = constructWeightDistribution(minWeight, maxWeight);
+        // Dans randomTreeLikeGenerator, une boucle v->v qui n'est pas tirée par probaSelf peut encore l'être comme arc vers un sommet de même profondeur
+        std::bernoulli_distribution selfDistribution(probaSelf + (1 - probaSelf) * probaSameDepth);
+
+        sink.begin(size, nPlayers, 0);
+        drawPlayersAndTargets(sink, size, nPlayers, sharedTargets, probaPlayers, probaTargets, maximumTargets, generator);
+
+        // On construit l'arbre. Les sommets sont créés dans l'ordre d'un parcours en largeur : les enfants de v sont firstChild[v], ..., firstChild[v+1] - 1
+        std::vector<std::size_t> firstChild(size + 1, size);
+        std::size_t nextFreeID = 1;
+        for (std::size_t root = 0 ; root < size ; root++) {
+            firstChild[root] = nextFreeID;
+            if (nextFreeID < size) {
+                nextFreeID = std::min(size, nextFreeID + branchingFactorDistribution(generator));
+            }
+        }
+
+        // Les profondeurs sont des intervalles d'IDs : la profondeur d+1 contient les enfants des sommets de profondeur d
+        std::vector<std::size_t> levelStart = {0, 1};
+        while (levelStart.back() < size) {
+            levelStart.push_back(firstChild[levelStart.back()]);
+        }
+
+        std::vector<long> weights(nPlayers);
+        std::unordered_set<std::size_t> chosen;
+        std::vector<std::size_t> sample;
+        std::size_t depth = 0;
+        for (std::size_t v = 0 ; v < size ; v++) {
+            while (levelStart[depth + 1] <= v) {
+                depth++;
+            }
+            const std::size_t ls = levelStart[depth], le = levelStart[depth + 1];
+            const std::size_t cb = firstChild[v], ce = firstChild[v + 1];
+            bool hasSuccessor = false;
+
+            // Les enfants
+            for (std::size_t c = cb ; c < ce ; c++) {
+                drawWeights(weights, generator, weightDistribution, multipleWeights);
+                sink.addEdge(v, c, weights.data());
+                hasSuccessor = true;
+            }
+
+            // La boucle sur v
+            if (selfDistribution(generator)) {
+                drawWeights(weights, generator, weightDistribution, multipleWeights);
+                sink.addEdge(v, v, weights.data());
+                hasSuccessor = true;
+            }
+
+            // On descend dans l'arbre (sans passer par les enfants)
+            std::size_t nDeeper = size - le - (ce - cb);
+            sampleDistinct(nDeeper, drawCount(nDeeper, probaSkipping, generator), generator, chosen, sample);
+            for (std::size_t i : sample) {
+                std::size_t u = le + i;
+                if (u >= cb) {
+                    u += ce - cb;
+                }
+                drawWeights(weights, generator, weightDistribution, multipleWeights);
+                sink.addEdge(v, u, weights.data());
+                hasSuccessor = true;
+            }
+
+            // Frères/cousins
+            std::size_t nSame = le - ls - 1;
+            sampleDistinct(nSame, drawCount(nSame, probaSameDepth, generator), generator, chosen, sample);
+            for (std::size_t i : sample) {
+                std::size_t u = ls + i;
+                if (u >= v) {
+                    u++;
+                }
+                drawWeights(weights, generator, weightDistribution, multipleWeights);
+                sink.addEdge(v, u, weights.data());
+                hasSuccessor = true;
+            }
+
+            // On remonte dans l'arbre
+            sampleDistinct(ls, drawCount(ls, probaClimbing, generator), generator, chosen, sample);
+            for (std::size_t u : sample) {
+                drawWeights(weights, generator, weightDistribution, multipleWeights);
+                sink.addEdge(v, u, weights.data());
+                hasSuccessor = true;
+            }
+
+            // On vérifie qu'on n'est pas dans un cul-de-sac
+            if (!hasSuccessor) {
+                drawWeights(weights, generator, weightDistribution, multipleWeights);
+                sink.addEdge(v, v, weights.data());
+            }
+        }
+
+        sink.finish();
+    }
+
+    void streamRandomStronglyConnectedGenerator(GameSink &sink, std::size_t size, std::size_t lowOutgoing, std::size_t upOutgoing, long minWeight, long maxWeight, bool multipleWeights, std::size_t nPlayers, bool sharedTargets, const std::vector<double>& probaPlayers, const std::vector<double>& probaTargets, const std::vector<types::Long>& maximumTargets, std::default_random_engine &generator) {
+        // On commence par générer un jeu sous forme compacte
+        CompactGameBuilder builder;
+        streamRandomGenerator(builder, size, lowOutgoing, upOutgoing, minWeight, maxWeight, multipleWeights, nPlayers, sharedTargets, probaPlayers, probaTargets, maximumTargets, generator);
+        const CompactGame base = builder.getGame();
+
+        algorithms::IncrementalComponents components(algorithms::tarjanIterative(size, base.getOffsets(), base.getSuccessors()));
+        auto weightDistribution = constructWeightDistribution(minWeight, maxWeight);
+
+        // Les arcs ajoutés : (départ, arrivée) et leurs poids
+        std::vector<std::pair<unsigned int, unsigned int>> extraEdges;
+        std::vector<long> extraWeights;
+        std::unordered_set<std::uint64_t> extraKeys;
+        std::vector<long> weights(nPlayers);
+
+        auto addExtra = [&](unsigned int from, unsigned int to) {
+            for (std::size_t e = base.beginEdges(from) ; e < base.endEdges(from) ; e++) {
+                if (base.getSuccessor(e) == to) {
+                    return;
+                }
+            }
+            if (!extraKeys.insert((std::uint64_t(from) << 32) | to).second) {
+                return;
+            }
+            drawWeights(weights, generator, weightDistribution, multipleWeights);
+            extraEdges.emplace_back(from, to);
+            extraWeights.insert(extraWeights.end(), weights.begin(), weights.end());
+        };
+
+        // Comme dans randomStronglyConnectedGenerator, on fusionne deux composantes aléatoires jusqu'à n'en avoir plus qu'une.
+        // On ne resynchronise pas avec Tarjan (il faudrait reconstruire le graphe) : on peut donc ajouter quelques arcs de plus que nécessaire, mais le graphe final est bien fortement connexe
+        while (components.size() > 1) {
+            std::uniform_int_distribution<std::size_t> componentSelection(0, components.size() - 1);
+            std::size_t i = 0, j = 0;
+            while (i == j) {
+                i = componentSelection(generator);
+                j = componentSelection(generator);
+            }
+
+            const std::vector<unsigned int> &a = components.getComponent(i);
+            const std::vector<unsigned int> &b = components.getComponent(j);
+            std::uniform_int_distribution<std::size_t> vertexASelection(0, a.size() - 1);
+            std::uniform_int_distribution<std::size_t> vertexBSelection(0, b.size() - 1);
+
+            unsigned int vAID = a[vertexASelection(generator)];
+            unsigned int uAID = a[vertexASelection(generator)];
+            unsigned int vBID = b[vertexBSelection(generator)];
+            unsigned int uBID = b[vertexBSelection(generator)];
+
+            addExtra(vAID, vBID);
+            addExtra(uBID, uAID);
+
+            components.merge(i, j);
+        }
+
+        // On trie les nouveaux arcs selon leur sommet de départ pour pouvoir tout envoyer dans l'ordre
+        std::vector<std::size_t> order(extraEdges.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) { return extraEdges[x].first < extraEdges[y].first; });
+
+        sink.begin(size, nPlayers, base.getInit());
+        for (std::size_t v = 0 ; v < size ; v++) {
+            sink.setPlayer(v, base.getPlayer(v));
+            for (std::size_t p = 0 ; p < nPlayers ; p++) {
+                if (base.isTargetFor(v, p)) {
+                    sink.addTarget(v, p);
+                }
+            }
+        }
+
+        std::size_t next = 0;
+        for (std::size_t v = 0 ; v < size ; v++) {
+            for (std::size_t e = base.beginEdges(v) ; e < base.endEdges(v) ; e++) {
+                sink.addEdge(v, base.getSuccessor(e), base.getWeights(e));
+            }
+            for ( ; next < order.size() && extraEdges[order[next]].first == v ; next++) {
+                sink.addEdge(v, extraEdges[order[next]].second, extraWeights.data() + order[next] * nPlayers);
+            }
+        }
+
+        sink.finish();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,313 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "io/BinaryGame.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "io/TextGame.hpp"
+
+static_assert(sizeof(long) == sizeof(std::int64_t), "Le format binaire suppose des long de 64 bits");
+static_assert(sizeof(std::size_t) == sizeof(std::uint64_t), "Le format binaire suppose des size_t de 64 bits");
+static_assert(sizeof(io::BinaryGameHeader) == 128, "L'en-tête doit faire 128 octets");
+
+namespace {
+    const char magic[8] = {'R', 'G', 'A', 'M', 'E', 'B', 'I', 'N'};
+    const std::uint32_t endiannessMarker = 0x01020304;
+    const std::size_t bufferSize = 1 << 20;
+
+    std::uint64_t align(std::uint64_t position) {
+        return (position + 7) & ~std::uint64_t(7);
+    }
+
+    void write(std::FILE* file, const void* data, std::size_t size) {
+        if (size != 0 && std::fwrite(data, 1, size, file) != size) {
+            throw std::runtime_error("BinaryGameWriter: impossible d'écrire dans le fichier");
+        }
+    }
+
+    void pad(std::FILE* file, std::uint64_t &position) {
+        const char zeros[8] = {0};
+        std::uint64_t aligned = align(position);
+        write(file, zeros, aligned - position);
+        position = aligned;
+    }
+
+    /**
+     * \brief Une projection en mémoire d'un fichier, libérée à la destruction
+     */
+    struct Mapping {
+        void* address;
+        std::size_t length;
+
+        Mapping(void* address, std::size_t length) : address(address), length(length) {}
+
+        ~Mapping() {
+            munmap(address, length);
+        }
+    };
+
+    bool sectionFits(std::uint64_t position, std::uint64_t count, std::uint64_t elementSize, std::uint64_t fileSize) {
+        return position % 8 == 0 && position <= fileSize && count <= (fileSize - position) / elementSize;
+    }
+}
+
+namespace io {
+    BinaryGameWriter::BinaryGameWriter(const std::string &path) :
+        m_path(path),
+        m_file(nullptr),
+        m_successorsFile(nullptr),
+        m_buffer(bufferSize),
+        m_lastFrom(0)
+        {
+        std::memset(&m_header, 0, sizeof(m_header));
+    }
+
+    BinaryGameWriter::~BinaryGameWriter() {
+        close();
+    }
+
+    void BinaryGameWriter::close() {
+        if (m_file) {
+            std::fclose(m_file);
+            m_file = nullptr;
+        }
+        if (m_successorsFile) {
+            std::fclose(m_successorsFile);
+            m_successorsFile = nullptr;
+        }
+    }
+
+    void BinaryGameWriter::begin(std::size_t nVertices, std::size_t nPlayers, unsigned int init) {
+        if (init >= nVertices) {
+            throw std::runtime_error("BinaryGameWriter: le sommet initial doit exister");
+        }
+        if (nPlayers == 0) {
+            throw std::runtime_error("BinaryGameWriter: il faut au moins un joueur");
+        }
+
+        close();
+        m_file = std::fopen(m_path.c_str(), "wb");
+        m_successorsFile = std::tmpfile();
+        if (!m_file || !m_successorsFile) {
+            close();
+            throw std::runtime_error("BinaryGameWriter: impossible d'ouvrir " + m_path);
+        }
+        std::setvbuf(m_file, m_buffer.data(), _IOFBF, m_buffer.size());
+
+        std::memset(&m_header, 0, sizeof(m_header));
+        std::memcpy(m_header.magic, magic, sizeof(magic));
+        m_header.version = binaryGameVersion;
+        m_header.endianness = endiannessMarker;
+        m_header.nVertices = nVertices;
+        m_header.nPlayers = nPlayers;
+        m_header.init = init;
+        m_header.weightsPosition = sizeof(BinaryGameHeader);
+
+        m_offsets.assign(nVertices + 1, 0);
+        m_owners.assign(nVertices, 0);
+        m_targets.assign(nVertices * CompactGame::targetWords(nPlayers), 0);
+        m_lastFrom = 0;
+
+        // L'en-tête définitif est écrit par finish
+        write(m_file, &m_header, sizeof(m_header));
+    }
+
+    void BinaryGameWriter::setPlayer(unsigned int vertex, unsigned int player) {
+        if (vertex >= m_header.nVertices || player >= m_header.nPlayers) {
+            throw std::runtime_error("BinaryGameWriter: sommet ou joueur inconnu");
+        }
+        m_owners[vertex] = player;
+    }
+
+    void BinaryGameWriter::addTarget(unsigned int vertex, unsigned int player) {
+        if (vertex >= m_header.nVertices || player >= m_header.nPlayers) {
+            throw std::runtime_error("BinaryGameWriter: sommet ou joueur inconnu");
+        }
+        m_targets[vertex * CompactGame::targetWords(m_header.nPlayers) + player / 64] |= std::uint64_t(1) << (player % 64);
+    }
+
+    void BinaryGameWriter::addEdge(unsigned int from, unsigned int to, const long* weights) {
+        if (from >= m_header.nVertices || to >= m_header.nVertices) {
+            throw std::runtime_error("BinaryGameWriter: un arc doit relier deux sommets existants");
+        }
+        if (from < m_lastFrom) {
+            throw std::runtime_error("BinaryGameWriter: les arcs doivent être triés selon leur sommet de départ");
+        }
+        m_lastFrom = from;
+        m_offsets[from + 1]++;
+        m_header.nEdges++;
+
+        const std::uint32_t successor = to;
+        write(m_file, weights, m_header.nPlayers * sizeof(long));
+        write(m_successorsFile, &successor, sizeof(successor));
+    }
+
+    void BinaryGameWriter::finish() {
+        std::uint64_t position = m_header.weightsPosition + m_header.nEdges * m_header.nPlayers * sizeof(long);
+
+        // On recopie les successeurs
+        m_header.successorsPosition = position;
+        // m_buffer sert de tampon à m_file : on en utilise un autre pour la copie
+        std::vector<char> copy(bufferSize);
+        std::rewind(m_successorsFile);
+        std::size_t read;
+        while ((read = std::fread(copy.data(), 1, copy.size(), m_successorsFile)) > 0) {
+            write(m_file, copy.data(), read);
+        }
+        position += m_header.nEdges * sizeof(std::uint32_t);
+        pad(m_file, position);
+
+        for (std::size_t v = 0 ; v < m_header.nVertices ; v++) {
+            m_offsets[v + 1] += m_offsets[v];
+        }
+        m_header.offsetsPosition = position;
+        write(m_file, m_offsets.data(), m_offsets.size() * sizeof(std::uint64_t));
+        position += m_offsets.size() * sizeof(std::uint64_t);
+
+        m_header.ownersPosition = position;
+        write(m_file, m_owners.data(), m_owners.size() * sizeof(std::uint32_t));
+        position += m_owners.size() * sizeof(std::uint32_t);
+        pad(m_file, position);
+
+        m_header.targetsPosition = position;
+        write(m_file, m_targets.data(), m_targets.size() * sizeof(std::uint64_t));
+        position += m_targets.size() * sizeof(std::uint64_t);
+        m_header.fileSize = position;
+
+        if (std::fseek(m_file, 0, SEEK_SET) != 0) {
+            throw std::runtime_error("BinaryGameWriter: impossible d'écrire l'en-tête");
+        }
+        write(m_file, &m_header, sizeof(m_header));
+        if (std::fflush(m_file) != 0) {
+            throw std::runtime_error("BinaryGameWriter: impossible d'écrire dans le fichier");
+        }
+        close();
+
+        std::vector<std::uint64_t>().swap(m_offsets);
+        std::vector<std::uint32_t>().swap(m_owners);
+        std::vector<std::uint64_t>().swap(m_targets);
+    }
+
+    void writeBinaryGame(const CompactGame &game, const std::string &path) {
+        BinaryGameWriter writer(path);
+        writer.begin(game.size(), game.getNumberPlayers(), game.getInit());
+        for (unsigned int v = 0 ; v < game.size() ; v++) {
+            writer.setPlayer(v, game.getPlayer(v));
+            for (unsigned int p = 0 ; p < game.getNumberPlayers() ; p++) {
+                if (game.isTargetFor(v, p)) {
+                    writer.addTarget(v, p);
+                }
+            }
+            for (std::size_t e = game.beginEdges(v) ; e < game.endEdges(v) ; e++) {
+                writer.addEdge(v, game.getSuccessor(e), game.getWeights(e));
+            }
+        }
+        writer.finish();
+    }
+
+    void writeBinaryGame(const ReachabilityGame &game, const std::string &path) {
+        writeBinaryGame(CompactGame::fromReachabilityGame(game), path);
+    }
+
+    CompactGame loadBinaryGame(const std::string &path, bool validate) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("loadBinaryGame: impossible d'ouvrir " + path);
+        }
+        struct stat status;
+        if (fstat(fd, &status) != 0 || std::size_t(status.st_size) < sizeof(BinaryGameHeader)) {
+            ::close(fd);
+            throw std::runtime_error("loadBinaryGame: " + path + " n'est pas un jeu binaire");
+        }
+        const std::size_t length = status.st_size;
+        void* address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("loadBinaryGame: impossible de projeter " + path + " en mémoire");
+        }
+        auto mapping = std::make_shared<Mapping>(address, length);
+
+        const char* base = static_cast<const char*>(address);
+        const BinaryGameHeader &header = *reinterpret_cast<const BinaryGameHeader*>(base);
+        if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+            throw std::runtime_error("loadBinaryGame: " + path + " n'est pas un jeu binaire");
+        }
+        if (header.version != binaryGameVersion) {
+            throw std::runtime_error("loadBinaryGame: version du format non supportée");
+        }
+        if (header.endianness != endiannessMarker) {
+            throw std::runtime_error("loadBinaryGame: le fichier a été écrit sur une machine d'un autre ordre des octets");
+        }
+        const std::uint64_t words = CompactGame::targetWords(header.nPlayers);
+        if (header.fileSize != length || header.nPlayers == 0 || header.init >= header.nVertices
+            || header.nVertices > length || header.nEdges > length || header.nPlayers > length
+            || !sectionFits(header.weightsPosition, header.nEdges * header.nPlayers, sizeof(long), length)
+            || !sectionFits(header.successorsPosition, header.nEdges, sizeof(std::uint32_t), length)
+            || !sectionFits(header.offsetsPosition, header.nVertices + 1, sizeof(std::uint64_t), length)
+            || !sectionFits(header.ownersPosition, header.nVertices, sizeof(std::uint32_t), length)
+            || !sectionFits(header.targetsPosition, header.nVertices * words, sizeof(std::uint64_t), length)) {
+            throw std::runtime_error("loadBinaryGame: en-tête invalide");
+        }
+
+        const std::size_t* offsets = reinterpret_cast<const std::size_t*>(base + header.offsetsPosition);
+        if (offsets[0] != 0 || offsets[header.nVertices] != header.nEdges) {
+            throw std::runtime_error("loadBinaryGame: en-tête invalide");
+        }
+
+        // Le contenu des tableaux est vérifié une fois (O(V+E)) : un fichier abîmé ne doit pas faire lire hors des tableaux
+        const unsigned int* successors = reinterpret_cast<const unsigned int*>(base + header.successorsPosition);
+        const unsigned int* owners = reinterpret_cast<const unsigned int*>(base + header.ownersPosition);
+        for (std::size_t v = 0 ; validate && v < header.nVertices ; v++) {
+            if (offsets[v] > offsets[v + 1] || offsets[v + 1] > header.nEdges) {
+                throw std::runtime_error("loadBinaryGame: les débuts des listes d'arcs de " + path + " sont invalides");
+            }
+            if (owners[v] >= header.nPlayers) {
+                throw std::runtime_error("loadBinaryGame: le sommet " + std::to_string(v) + " de " + path + " appartient à un joueur inexistant");
+            }
+        }
+        for (std::size_t e = 0 ; validate && e < header.nEdges ; e++) {
+            if (successors[e] >= header.nVertices) {
+                throw std::runtime_error("loadBinaryGame: l'arc " + std::to_string(e) + " de " + path + " mène à un sommet inexistant");
+            }
+        }
+
+        return CompactGame(header.nVertices, header.nEdges, header.nPlayers, header.init,
+            offsets,
+            successors,
+            reinterpret_cast<const long*>(base + header.weightsPosition),
+            owners,
+            reinterpret_cast<const std::uint64_t*>(base + header.targetsPosition),
+            mapping);
+    }
+
+    CompactGame loadGame(const std::string &path) {
+        const std::string extension = ".rgb";
+        if (path.size() >= extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0) {
+            return loadBinaryGame(path);
+        }
+        return loadTextGame(path);
+    }
+}
\ No newline at end of file
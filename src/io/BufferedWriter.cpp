@@ -0,0 +1,186 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "io/BufferedWriter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace io {
+    BufferedWriter::BufferedWriter(const std::string &path, std::size_t bufferSize) :
+        m_kind(Kind::Descriptor),
+        m_fd(open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)),
+        m_ownsDescriptor(true),
+        m_file(nullptr),
+        m_stream(nullptr),
+        m_buffer(std::max<std::size_t>(bufferSize, 32)),
+        m_used(0)
+        {
+        if (m_fd < 0) {
+            throw std::runtime_error("BufferedWriter: impossible d'ouvrir " + path);
+        }
+    }
+
+    BufferedWriter::BufferedWriter(int fd, std::size_t bufferSize) :
+        m_kind(Kind::Descriptor),
+        m_fd(fd),
+        m_ownsDescriptor(false),
+        m_file(nullptr),
+        m_stream(nullptr),
+        m_buffer(std::max<std::size_t>(bufferSize, 32)),
+        m_used(0)
+        {
+    }
+
+    BufferedWriter::BufferedWriter(std::FILE* file, std::size_t bufferSize) :
+        m_kind(Kind::File),
+        m_fd(-1),
+        m_ownsDescriptor(false),
+        m_file(file),
+        m_stream(nullptr),
+        m_buffer(std::max<std::size_t>(bufferSize, 32)),
+        m_used(0)
+        {
+    }
+
+    BufferedWriter::BufferedWriter(std::ostream &stream, std::size_t bufferSize) :
+        m_kind(Kind::Stream),
+        m_fd(-1),
+        m_ownsDescriptor(false),
+        m_file(nullptr),
+        m_stream(&stream),
+        m_buffer(std::max<std::size_t>(bufferSize, 32)),
+        m_used(0)
+        {
+    }
+
+    BufferedWriter::~BufferedWriter() {
+        try {
+            flush();
+        }
+        catch (const std::runtime_error&) {
+            // On ne peut pas lancer d'exception depuis un destructeur
+        }
+        if (m_ownsDescriptor) {
+            close(m_fd);
+        }
+    }
+
+    void BufferedWriter::write(const char* data, std::size_t size) {
+        if (size >= m_buffer.size()) {
+            // Trop grand pour le tampon : on l'écrit directement
+            flushBuffer();
+            writeDirect(data, size);
+            return;
+        }
+        if (m_used + size > m_buffer.size()) {
+            flushBuffer();
+        }
+        std::memcpy(m_buffer.data() + m_used, data, size);
+        m_used += size;
+    }
+
+    void BufferedWriter::writeUnsigned(unsigned long value) {
+        // Les chiffres sont produits deux par deux à partir d'une table
+        static const char pairs[] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+        if (m_used + 20 > m_buffer.size()) {
+            flushBuffer();
+        }
+        char digits[20];
+        std::size_t n = 20;
+        while (value >= 100) {
+            const std::size_t pair = (value % 100) * 2;
+            value /= 100;
+            digits[--n] = pairs[pair + 1];
+            digits[--n] = pairs[pair];
+        }
+        if (value >= 10) {
+            digits[--n] = pairs[value * 2 + 1];
+            digits[--n] = pairs[value * 2];
+        }
+        else {
+            digits[--n] = '0' + value;
+        }
+        std::memcpy(m_buffer.data() + m_used, digits + n, 20 - n);
+        m_used += 20 - n;
+    }
+
+    void BufferedWriter::writeLong(long value) {
+        if (value < 0) {
+            put('-');
+            // On passe par un unsigned pour gérer LONG_MIN
+            writeUnsigned(0UL - static_cast<unsigned long>(value));
+        }
+        else {
+            writeUnsigned(value);
+        }
+    }
+
+    void BufferedWriter::flush() {
+        flushBuffer();
+        if (m_kind == Kind::File) {
+            std::fflush(m_file);
+        }
+        else if (m_kind == Kind::Stream) {
+            m_stream->flush();
+        }
+    }
+
+    void BufferedWriter::flushBuffer() {
+        std::size_t used = m_used;
+        m_used = 0;
+        writeDirect(m_buffer.data(), used);
+    }
+
+    void BufferedWriter::writeDirect(const char* data, std::size_t remaining) {
+        switch (m_kind) {
+        case Kind::Descriptor:
+            while (remaining > 0) {
+                ssize_t n = ::write(m_fd, data, remaining);
+                if (n < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::runtime_error("BufferedWriter: erreur d'écriture");
+                }
+                data += n;
+                remaining -= n;
+            }
+            break;
+        case Kind::File:
+            if (remaining != 0 && std::fwrite(data, 1, remaining, m_file) != remaining) {
+                throw std::runtime_error("BufferedWriter: erreur d'écriture");
+            }
+            break;
+        case Kind::Stream:
+            m_stream->write(data, remaining);
+            if (!*m_stream) {
+                throw std::runtime_error("BufferedWriter: erreur d'écriture");
+            }
+            break;
+        }
+    }
+}
\ No newline at end of file
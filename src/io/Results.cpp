@@ -0,0 +1,121 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "io/Results.hpp"
+
+#include <cstdio>
+#include <new>
+
+#include "exploration/BestFirstSearch.hpp"
+#include "exploration/RandomPaths.hpp"
+
+namespace io {
+    std::string escapeJSON(const std::string &text) {
+        std::string escaped;
+        escaped.reserve(text.size());
+        for (char c : text) {
+            switch (c) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            case '\r': escaped += "\\r"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                    escaped += buffer;
+                }
+                else {
+                    escaped += c;
+                }
+            }
+        }
+        return escaped;
+    }
+
+    std::string pathToJSON(const Path &path) {
+        std::string json = "\"path\":[";
+        bool first = true;
+        for (const auto &step : path.getSteps()) {
+            if (!first) {
+                json += ',';
+            }
+            json += std::to_string(step->getID());
+            first = false;
+        }
+        json += "],\"costs\":[";
+        first = true;
+        for (const auto &cost : path.getCosts()) {
+            json += first ? "{" : ",{";
+            json += std::string("\"reached\":") + (cost.first ? "true" : "false") + ",\"cost\":" + (cost.second.isInfinity() ? "null" : std::to_string(cost.second.getValue())) + "}";
+            first = false;
+        }
+        json += "]";
+        return json;
+    }
+
+    std::string millisecondsToJSON(std::chrono::steady_clock::duration duration) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.3f", std::chrono::duration<double, std::milli>(duration).count());
+        return buffer;
+    }
+
+    types::Long remainingSeconds(std::chrono::steady_clock::time_point deadline, std::chrono::steady_clock::time_point now) {
+        if (now >= deadline) {
+            return 0;
+        }
+        const std::chrono::steady_clock::duration remaining = deadline - now;
+        long seconds = std::chrono::duration_cast<std::chrono::seconds>(remaining).count();
+        if (std::chrono::seconds(seconds) < remaining) {
+            seconds++;
+        }
+        return seconds;
+    }
+
+    SolveResult runEngine(const exploration::engineSignature &engine, ReachabilityGame &game, const exploration::EngineOptions &options) {
+        SolveResult result;
+        game.setCoalitionThreads(options.nThreads);
+        try {
+            Path path = engine(game, options);
+            result.details = pathToJSON(path);
+            result.status = "ok";
+        }
+        catch (const exploration::OutOfTime &e) {
+            result.status = "timeout";
+            result.message = e.what();
+        }
+        catch (const exploration::EmptyFrontier &e) {
+            result.status = "no_equilibrium";
+            result.message = e.what();
+        }
+        catch (const exploration::NoENGenerated &e) {
+            result.status = "no_equilibrium";
+            result.message = e.what();
+        }
+        catch (const std::bad_alloc &e) {
+            result.status = "out_of_memory";
+            result.message = "mémoire insuffisante";
+        }
+        catch (const std::exception &e) {
+            result.status = "error";
+            result.message = e.what();
+        }
+        return result;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,457 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "io/SolverDaemon.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "exploration/Engines.hpp"
+#include "io/BinaryGame.hpp"
+#include "io/Results.hpp"
+#include "io/TextGame.hpp"
+
+namespace io {
+    /**
+     * \brief Une connexion d'un client : lit les lignes et les charges utiles, écrit les réponses
+     */
+    class SolverDaemon::Connection {
+    public:
+        explicit Connection(int socket) :
+            m_socket(socket),
+            m_buffer(1 << 16),
+            m_begin(0),
+            m_end(0)
+            {
+
+        }
+
+        /**
+         * \brief Lit une ligne (sans le retour à la ligne)
+         * \return Faux si la connexion est fermée avant la fin de la ligne
+         */
+        bool readLine(std::string &line) {
+            line.clear();
+            while (true) {
+                for (std::size_t i = m_begin ; i < m_end ; i++) {
+                    if (m_buffer[i] == '\n') {
+                        line.append(m_buffer.data() + m_begin, i - m_begin);
+                        m_begin = i + 1;
+                        if (!line.empty() && line.back() == '\r') {
+                            line.pop_back();
+                        }
+                        return true;
+                    }
+                }
+                line.append(m_buffer.data() + m_begin, m_end - m_begin);
+                m_begin = m_end = 0;
+                if (!fill()) {
+                    return false;
+                }
+            }
+        }
+
+        /**
+         * \brief Lit exactement size octets
+         * \return Faux si la connexion est fermée avant
+         */
+        bool readBytes(std::size_t size, std::string &bytes) {
+            bytes.clear();
+            bytes.reserve(size);
+            while (bytes.size() < size) {
+                if (m_begin == m_end) {
+                    m_begin = m_end = 0;
+                    if (!fill()) {
+                        return false;
+                    }
+                }
+                const std::size_t n = std::min(size - bytes.size(), m_end - m_begin);
+                bytes.append(m_buffer.data() + m_begin, n);
+                m_begin += n;
+            }
+            return true;
+        }
+
+        /**
+         * \brief Envoie une ligne
+         * \return Faux si la connexion est fermée
+         */
+        bool send(std::string line) {
+            line += '\n';
+            std::size_t written = 0;
+            while (written < line.size()) {
+                const ssize_t n = ::send(m_socket, line.data() + written, line.size() - written, MSG_NOSIGNAL);
+                if (n < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (n <= 0) {
+                    return false;
+                }
+                written += std::size_t(n);
+            }
+            return true;
+        }
+
+    private:
+        bool fill() {
+            while (true) {
+                const ssize_t n = ::read(m_socket, m_buffer.data(), m_buffer.size());
+                if (n < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (n <= 0) {
+                    return false;
+                }
+                m_end = std::size_t(n);
+                return true;
+            }
+        }
+
+    private:
+        int m_socket;
+        std::vector<char> m_buffer;
+        std::size_t m_begin, m_end;
+    };
+
+    namespace {
+        std::string error(const std::string &message) {
+            return "{\"ok\":false,\"error\":\"" + escapeJSON(message) + "\"}";
+        }
+
+        std::size_t parseSize(const std::string &text, const std::string &what) {
+            std::size_t used = 0;
+            unsigned long long value = 0;
+            try {
+                value = std::stoull(text, &used);
+            }
+            catch (const std::logic_error&) {
+                used = 0;
+            }
+            if (used != text.size() || text.empty() || text[0] == '-') {
+                throw std::runtime_error(what + " attend un entier positif, pas " + text);
+            }
+            return std::size_t(value);
+        }
+    }
+
+    SolverDaemon::SolverDaemon(const std::string &socketPath, std::size_t nThreads) :
+        m_socketPath(socketPath),
+        m_listener(-1),
+        m_stopped(false),
+        m_pool(nThreads)
+        {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("Chemin de socket invalide : " + socketPath);
+        }
+        std::memcpy(address.sun_path, socketPath.data(), socketPath.size());
+
+        m_listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (m_listener < 0) {
+            throw std::runtime_error("Impossible de créer le socket : " + std::string(std::strerror(errno)));
+        }
+        ::unlink(socketPath.c_str());
+        if (::bind(m_listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(m_listener, 64) != 0) {
+            const std::string reason = std::strerror(errno);
+            ::close(m_listener);
+            throw std::runtime_error("Impossible d'écouter sur " + socketPath + " : " + reason);
+        }
+    }
+
+    SolverDaemon::~SolverDaemon() {
+        stop();
+        std::vector<std::pair<std::thread, std::shared_ptr<std::atomic<bool>>>> clients;
+        {
+            std::lock_guard<std::mutex> lock(m_clientsMutex);
+            clients.swap(m_clients);
+        }
+        for (auto &client : clients) {
+            client.first.join();
+        }
+        ::close(m_listener);
+        ::unlink(m_socketPath.c_str());
+    }
+
+    void SolverDaemon::run() {
+        while (!m_stopped) {
+            const int client = ::accept(m_listener, nullptr, nullptr);
+            if (client < 0) {
+                if (errno == EINTR || errno == ECONNABORTED) {
+                    continue;
+                }
+                break;
+            }
+
+            std::lock_guard<std::mutex> lock(m_clientsMutex);
+            if (m_stopped) {
+                ::close(client);
+                break;
+            }
+            // On en profite pour libérer les threads des connexions terminées
+            for (auto itr = m_clients.begin() ; itr != m_clients.end() ; ) {
+                if (*itr->second) {
+                    itr->first.join();
+                    itr = m_clients.erase(itr);
+                }
+                else {
+                    ++itr;
+                }
+            }
+            auto done = std::make_shared<std::atomic<bool>>(false);
+            m_clientSockets.insert(client);
+            m_clients.emplace_back(std::thread([this, client, done]() {
+                serve(client);
+                *done = true;
+            }), done);
+        }
+
+        std::vector<std::pair<std::thread, std::shared_ptr<std::atomic<bool>>>> clients;
+        {
+            std::lock_guard<std::mutex> lock(m_clientsMutex);
+            clients.swap(m_clients);
+        }
+        for (auto &client : clients) {
+            client.first.join();
+        }
+    }
+
+    void SolverDaemon::stop() {
+        if (m_stopped.exchange(true)) {
+            return;
+        }
+        // shutdown débloque accept et les lectures en cours sans fermer les descripteurs encore utilisés
+        ::shutdown(m_listener, SHUT_RDWR);
+        std::lock_guard<std::mutex> lock(m_clientsMutex);
+        for (int client : m_clientSockets) {
+            ::shutdown(client, SHUT_RDWR);
+        }
+    }
+
+    void SolverDaemon::serve(int client) {
+        Connection connection(client);
+        std::string request;
+        while (!m_stopped && connection.readLine(request)) {
+            if (request.empty()) {
+                continue;
+            }
+            const std::string response = handle(request, &connection);
+            if (!connection.send(response)) {
+                break;
+            }
+            if (request == "quit") {
+                break;
+            }
+            if (request == "shutdown") {
+                stop();
+                break;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_clientsMutex);
+        m_clientSockets.erase(client);
+        ::close(client);
+    }
+
+    std::string SolverDaemon::handle(const std::string &request) {
+        return handle(request, nullptr);
+    }
+
+    std::string SolverDaemon::handle(const std::string &request, Connection *connection) {
+        const auto received = std::chrono::steady_clock::now();
+        std::istringstream stream(request);
+        std::string command;
+        stream >> command;
+
+        try {
+            if (command == "load") {
+                std::string name, path;
+                stream >> name;
+                std::getline(stream >> std::ws, path);
+                if (name.empty() || path.empty()) {
+                    return error("utilisation : load <nom> <fichier>");
+                }
+                return addGame(name, loadGame(path));
+            }
+            else if (command == "game") {
+                std::string name, format, size;
+                stream >> name >> format >> size;
+                if (name.empty() || size.empty()) {
+                    return error("utilisation : game <nom> <edgelist|dot> <taille>");
+                }
+                const std::size_t nBytes = parseSize(size, "game");
+                if (connection == nullptr) {
+                    return error("pas de connexion pour lire le jeu");
+                }
+                std::string text;
+                if (!connection->readBytes(nBytes, text)) {
+                    return error("connexion fermée pendant la lecture du jeu");
+                }
+                CompactGameBuilder builder;
+                if (format == "edgelist") {
+                    parseEdgeList(text.data(), text.size(), builder);
+                }
+                else if (format == "dot") {
+                    parseDOT(text.data(), text.size(), builder);
+                }
+                else {
+                    return error("format inconnu : " + format);
+                }
+                return addGame(name, builder.getGame());
+            }
+            else if (command == "warm") {
+                std::string name;
+                stream >> name;
+                std::shared_ptr<ReachabilityGame> game = findGame(name);
+                const auto start = std::chrono::steady_clock::now();
+                m_pool.submit([game]() {
+                    game->getCostsMap();
+                    for (unsigned int p = 0 ; p < game->getPlayers().size() ; p++) {
+                        game->getCoalitionValues(p);
+                    }
+                }).get();
+                return "{\"ok\":true,\"name\":\"" + escapeJSON(name) + "\",\"warm_ms\":" + millisecondsToJSON(std::chrono::steady_clock::now() - start) + "}";
+            }
+            else if (command == "solve") {
+                std::string name, engineName, option;
+                stream >> name >> engineName;
+                if (name.empty() || engineName.empty()) {
+                    return error("utilisation : solve <nom> <moteur> [time=<s>] [paths=<n>] [threads=<n>] [beam=<n>] [ties=<règle>] [symmetries=<0|1>]");
+                }
+                exploration::EngineOptions options;
+                while (stream >> option) {
+                    if (option.compare(0, 5, "time=") == 0) {
+                        options.allowedTime = types::Long(long(parseSize(option.substr(5), "time")));
+                    }
+                    else if (option.compare(0, 6, "paths=") == 0) {
+                        options.nPaths = parseSize(option.substr(6), "paths");
+                    }
+                    else if (option.compare(0, 8, "threads=") == 0) {
+                        options.nThreads = parseSize(option.substr(8), "threads");
+                    }
+                    else if (option.compare(0, 5, "beam=") == 0) {
+                        options.beamWidth = parseSize(option.substr(5), "beam");
+                    }
+                    else if (option.compare(0, 5, "ties=") == 0) {
+                        options.tieBreaking = exploration::parseTieBreaking(option.substr(5));
+                    }
+                    else if (option.compare(0, 11, "symmetries=") == 0) {
+                        options.symmetries = parseSize(option.substr(11), "symmetries") != 0;
+                    }
+                    else {
+                        return error("option inconnue : " + option);
+                    }
+                }
+                const exploration::engineSignature &engine = exploration::findEngine(engineName);
+                std::shared_ptr<ReachabilityGame> game = findGame(name);
+
+                // L'échéance est fixée à la réception : le temps passé dans la file d'attente est décompté du temps permis, à la nanoseconde près
+                std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+                if (!options.allowedTime.isInfinity()) {
+                    // Au-delà d'un siècle, l'échéance dépasserait la capacité de steady_clock : autant dire aucune limite
+                    const long century = 100L * 365 * 24 * 3600;
+                    if (options.allowedTime.getValue() < century) {
+                        deadline = received + std::chrono::seconds(options.allowedTime.getValue());
+                    }
+                }
+
+                std::chrono::steady_clock::duration waited{};
+                SolveResult result = m_pool.submit([&]() {
+                    const auto start = std::chrono::steady_clock::now();
+                    waited = start - received;
+                    exploration::EngineOptions remaining = options;
+                    if (!options.allowedTime.isInfinity()) {
+                        remaining.allowedTime = remainingSeconds(deadline, start);
+                        if (remaining.allowedTime <= 0) {
+                            return SolveResult{"timeout", "", "temps écoulé avant le début de la résolution"};
+                        }
+                    }
+                    return runEngine(engine, *game, remaining);
+                }).get();
+                const auto end = std::chrono::steady_clock::now();
+
+                std::string response = "{\"ok\":true,\"name\":\"" + escapeJSON(name) + "\",\"engine\":\"" + escapeJSON(engineName) + "\",\"status\":\"" + result.status + "\",\"queue_ms\":" + millisecondsToJSON(waited) + ",\"solve_ms\":" + millisecondsToJSON(end - received - waited);
+                if (!result.details.empty()) {
+                    response += "," + result.details;
+                }
+                if (!result.message.empty()) {
+                    response += ",\"message\":\"" + escapeJSON(result.message) + "\"";
+                }
+                return response + "}";
+            }
+            else if (command == "unload") {
+                std::string name;
+                stream >> name;
+                std::lock_guard<std::mutex> lock(m_gamesMutex);
+                if (m_games.erase(name) == 0) {
+                    return error("jeu inconnu : " + name);
+                }
+                return "{\"ok\":true,\"name\":\"" + escapeJSON(name) + "\"}";
+            }
+            else if (command == "list") {
+                std::string response = "{\"ok\":true,\"games\":[";
+                std::lock_guard<std::mutex> lock(m_gamesMutex);
+                bool first = true;
+                for (const auto &game : m_games) {
+                    if (!first) {
+                        response += ',';
+                    }
+                    response += "{\"name\":\"" + escapeJSON(game.first) + "\",\"vertices\":" + std::to_string(game.second->getGraph().size()) + ",\"players\":" + std::to_string(game.second->getPlayers().size()) + "}";
+                    first = false;
+                }
+                return response + "]}";
+            }
+            else if (command == "quit" || command == "shutdown") {
+                return "{\"ok\":true}";
+            }
+            return error("commande inconnue : " + command);
+        }
+        catch (const std::bad_alloc&) {
+            return error("mémoire insuffisante");
+        }
+        catch (const std::exception &e) {
+            return error(e.what());
+        }
+    }
+
+    std::string SolverDaemon::addGame(const std::string &name, const CompactGame &compact) {
+        auto game = std::make_shared<ReachabilityGame>(compact.toReachabilityGame());
+        {
+            std::lock_guard<std::mutex> lock(m_gamesMutex);
+            m_games[name] = game;
+        }
+        return "{\"ok\":true,\"name\":\"" + escapeJSON(name) + "\",\"vertices\":" + std::to_string(compact.size()) + ",\"edges\":" + std::to_string(compact.getNumberEdges()) + ",\"players\":" + std::to_string(compact.getNumberPlayers()) + "}";
+    }
+
+    std::shared_ptr<ReachabilityGame> SolverDaemon::findGame(const std::string &name) {
+        std::lock_guard<std::mutex> lock(m_gamesMutex);
+        auto itr = m_games.find(name);
+        if (itr == m_games.end()) {
+            throw std::runtime_error("jeu inconnu : " + name);
+        }
+        return itr->second;
+    }
+}
\ No newline at end of file
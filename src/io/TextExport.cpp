@@ -0,0 +1,173 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "io/TextExport.hpp"
+
+#include <stdexcept>
+
+namespace {
+    const char* const shapes[] = {"circle", "square", "diamond", "triangle", "pentagon", "hexagon", "septagon", "octagon"};
+    const char* const colors[] = {"red", "blue", "green", "orange", "purple", "brown", "cyan", "magenta"};
+    const std::size_t nStyles = 8;
+
+    void writeWeights(io::BufferedWriter &writer, const long* weights, std::size_t nPlayers) {
+        for (std::size_t i = 0 ; i < nPlayers ; i++) {
+            writer.put(' ');
+            writer.writeLong(weights[i]);
+        }
+    }
+}
+
+namespace io {
+    void writeDOT(const CompactGame &game, BufferedWriter &writer) {
+        const std::size_t nPlayers = game.getNumberPlayers();
+
+        writer << "digraph G {\nplayers=" << nPlayers << ";\n";
+        for (unsigned int v = 0 ; v < game.size() ; v++) {
+            const unsigned int player = game.getPlayer(v);
+            writer << 'v' << v << " [label=\"v" << v << "\", player=" << player << ", shape=" << shapes[player % nStyles];
+            if (v == game.getInit()) {
+                writer << ", init=true";
+            }
+
+            if (game.isTarget(v)) {
+                std::size_t nTargets = 0;
+                writer << ", targets=\"";
+                for (unsigned int p = 0 ; p < nPlayers ; p++) {
+                    if (game.isTargetFor(v, p)) {
+                        if (nTargets == 0) {
+                            writer << p;
+                        }
+                        else {
+                            writer << ',' << p;
+                        }
+                        nTargets++;
+                    }
+                }
+                writer << '"';
+
+                for (unsigned int p = 0 ; p < nPlayers ; p++) {
+                    if (game.isTargetFor(v, p)) {
+                        writer << ", color=" << colors[p % nStyles] << ", penwidth=2";
+                        break;
+                    }
+                }
+                if (nTargets > 1) {
+                    writer << ", peripheries=2";
+                }
+            }
+            writer << "];\n";
+        }
+
+        for (unsigned int v = 0 ; v < game.size() ; v++) {
+            for (std::size_t e = game.beginEdges(v) ; e < game.endEdges(v) ; e++) {
+                const long* weights = game.getWeights(e);
+                writer << 'v' << v << " -> v" << game.getSuccessor(e) << " [label=\"(";
+                for (std::size_t i = 0 ; i < nPlayers ; i++) {
+                    if (i != 0) {
+                        writer << ", ";
+                    }
+                    writer.writeLong(weights[i]);
+                }
+                writer << ")\"];\n";
+            }
+        }
+
+        writer << "}\n";
+        writer.flush();
+    }
+
+    void writeDOT(const ReachabilityGame &game, BufferedWriter &writer) {
+        writeDOT(CompactGame::fromReachabilityGame(game), writer);
+    }
+
+    void writeEdgeList(const CompactGame &game, BufferedWriter &writer) {
+        const std::size_t nPlayers = game.getNumberPlayers();
+
+        writer << "game " << game.size() << ' ' << nPlayers << ' ' << game.getInit() << '\n';
+        for (unsigned int v = 0 ; v < game.size() ; v++) {
+            if (game.getPlayer(v) == 0 && !game.isTarget(v)) {
+                continue;
+            }
+            writer << "v " << v << ' ' << game.getPlayer(v);
+            for (unsigned int p = 0 ; p < nPlayers ; p++) {
+                if (game.isTargetFor(v, p)) {
+                    writer << ' ' << p;
+                }
+            }
+            writer.put('\n');
+        }
+
+        for (unsigned int v = 0 ; v < game.size() ; v++) {
+            for (std::size_t e = game.beginEdges(v) ; e < game.endEdges(v) ; e++) {
+                writer << "e " << v << ' ' << game.getSuccessor(e);
+                writeWeights(writer, game.getWeights(e), nPlayers);
+                writer.put('\n');
+            }
+        }
+        writer.flush();
+    }
+
+    void writeEdgeList(const ReachabilityGame &game, BufferedWriter &writer) {
+        writeEdgeList(CompactGame::fromReachabilityGame(game), writer);
+    }
+
+    EdgeListWriter::EdgeListWriter(BufferedWriter &writer) :
+        m_writer(writer),
+        m_nPlayers(0)
+        {
+    }
+
+    void EdgeListWriter::begin(std::size_t nVertices, std::size_t nPlayers, unsigned int init) {
+        if (init >= nVertices) {
+            throw std::runtime_error("EdgeListWriter: le sommet initial doit exister");
+        }
+        m_nPlayers = nPlayers;
+        m_owners.assign(nVertices, 0);
+        m_writer << "game " << nVertices << ' ' << nPlayers << ' ' << init << '\n';
+    }
+
+    void EdgeListWriter::setPlayer(unsigned int vertex, unsigned int player) {
+        if (vertex >= m_owners.size() || player >= m_nPlayers) {
+            throw std::runtime_error("EdgeListWriter: sommet ou joueur inconnu");
+        }
+        if (player != 0 || m_owners[vertex] != 0) {
+            m_writer << "v " << vertex << ' ' << player << '\n';
+        }
+        m_owners[vertex] = player;
+    }
+
+    void EdgeListWriter::addTarget(unsigned int vertex, unsigned int player) {
+        if (vertex >= m_owners.size() || player >= m_nPlayers) {
+            throw std::runtime_error("EdgeListWriter: sommet ou joueur inconnu");
+        }
+        // Une ligne v de plus ne fait qu'ajouter une cible (et redonner le propriétaire)
+        m_writer << "v " << vertex << ' ' << m_owners[vertex] << ' ' << player << '\n';
+    }
+
+    void EdgeListWriter::addEdge(unsigned int from, unsigned int to, const long* weights) {
+        m_writer << "e " << from << ' ' << to;
+        writeWeights(m_writer, weights, m_nPlayers);
+        m_writer.put('\n');
+    }
+
+    void EdgeListWriter::finish() {
+        m_writer.flush();
+        std::vector<unsigned int>().swap(m_owners);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,848 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "io/TextGame.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+    /**
+     * \brief Lit un descripteur de fichier par blocs de 1 Mo, caractère par caractère, en comptant les lignes
+     */
+    class ChunkReader {
+    public:
+        ChunkReader(int fd, const char* context) :
+            m_fd(fd),
+            m_buffer(1 << 20),
+            m_data(m_buffer.data()),
+            m_position(0),
+            m_end(0),
+            m_line(1),
+            m_context(context)
+            {
+        }
+
+        /**
+         * \brief Lit directement une zone de mémoire (sans copie)
+         */
+        ChunkReader(const char* data, std::size_t size, const char* context) :
+            m_fd(-1),
+            m_data(data),
+            m_position(0),
+            m_end(size),
+            m_line(1),
+            m_context(context)
+            {
+        }
+
+        /**
+         * \brief Donne le prochain caractère sans le consommer (-1 à la fin du fichier)
+         */
+        int peek() {
+            if (m_position == m_end && !fill()) {
+                return -1;
+            }
+            return static_cast<unsigned char>(m_data[m_position]);
+        }
+
+        /**
+         * \brief Consomme le prochain caractère (-1 à la fin du fichier)
+         */
+        int get() {
+            int c = peek();
+            if (c != -1) {
+                m_position++;
+                if (c == '\n') {
+                    m_line++;
+                }
+            }
+            return c;
+        }
+
+        /**
+         * \brief Passe les espaces et les tabulations (mais pas les fins de ligne)
+         */
+        void skipBlanks() {
+            int c;
+            while ((c = peek()) == ' ' || c == '\t' || c == '\r') {
+                m_position++;
+            }
+        }
+
+        /**
+         * \brief Passe tout jusqu'au début de la ligne suivante
+         */
+        void skipLine() {
+            int c;
+            while ((c = get()) != -1 && c != '\n') {
+            }
+        }
+
+        /**
+         * \brief Regarde s'il ne reste rien d'utile sur la ligne (fin de ligne, fin de fichier ou commentaire)
+         */
+        bool atEndOfLine() {
+            skipBlanks();
+            int c = peek();
+            return c == -1 || c == '\n' || c == '#';
+        }
+
+        /**
+         * \brief Lit un entier signé
+         */
+        long readLong() {
+            skipBlanks();
+            bool negative = false;
+            int c = peek();
+            if (c == '-' || c == '+') {
+                negative = c == '-';
+                m_position++;
+                c = peek();
+            }
+            if (c < '0' || c > '9') {
+                error("entier attendu");
+            }
+            long value = 0;
+            while (c >= '0' && c <= '9') {
+                if (value > (LONG_MAX - (c - '0')) / 10) {
+                    error("entier trop grand");
+                }
+                value = value * 10 + (c - '0');
+                m_position++;
+                c = peek();
+            }
+            return negative ? -value : value;
+        }
+
+        /**
+         * \brief Lit un mot (jusqu'au prochain espace)
+         */
+        std::string readWord() {
+            skipBlanks();
+            std::string word;
+            int c;
+            while ((c = peek()) != -1 && c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+                word.push_back(c);
+                m_position++;
+            }
+            return word;
+        }
+
+        [[noreturn]] void error(const std::string &message) const {
+            throw std::runtime_error(std::string(m_context) + ": ligne " + std::to_string(m_line) + " : " + message);
+        }
+
+    private:
+        bool fill() {
+            if (m_fd < 0) {
+                return false;
+            }
+            ssize_t n;
+            do {
+                n = read(m_fd, m_buffer.data(), m_buffer.size());
+            } while (n < 0 && errno == EINTR);
+            if (n < 0) {
+                error("erreur de lecture");
+            }
+            m_position = 0;
+            m_end = n;
+            return n > 0;
+        }
+
+        int m_fd;
+        std::vector<char> m_buffer;
+        const char* m_data;
+        std::size_t m_position;
+        std::size_t m_end;
+        std::size_t m_line;
+        const char* m_context;
+    };
+
+    /**
+     * \brief Ouvre un fichier en lecture et le ferme à la destruction
+     */
+    struct InputFile {
+        int fd;
+
+        InputFile(const std::string &path, const char* context) : fd(open(path.c_str(), O_RDONLY)) {
+            if (fd < 0) {
+                throw std::runtime_error(std::string(context) + ": impossible d'ouvrir " + path);
+            }
+        }
+
+        ~InputFile() {
+            close(fd);
+        }
+    };
+
+    /**
+     * \brief Extrait tous les entiers d'une chaîne (les autres caractères servent de séparateurs)
+     */
+    std::vector<long> extractIntegers(const std::string &text) {
+        std::vector<long> values;
+        for (std::size_t i = 0 ; i < text.size() ; ) {
+            bool negative = text[i] == '-' && i + 1 < text.size() && text[i + 1] >= '0' && text[i + 1] <= '9';
+            if (negative) {
+                i++;
+            }
+            if (text[i] >= '0' && text[i] <= '9') {
+                long value = 0;
+                while (i < text.size() && text[i] >= '0' && text[i] <= '9') {
+                    if (value > (LONG_MAX - (text[i] - '0')) / 10) {
+                        throw std::runtime_error("parseDOT: entier trop grand : " + text);
+                    }
+                    value = value * 10 + (text[i] - '0');
+                    i++;
+                }
+                values.push_back(negative ? -value : value);
+            }
+            else {
+                i++;
+            }
+        }
+        return values;
+    }
+
+    /**
+     * \brief Découpe un fichier DOT en lexèmes
+     */
+    class DOTLexer {
+    public:
+        struct Token {
+            bool symbol; // Un symbole ({, }, [, ], =, ;, , ou ->) ou un identifiant (éventuellement entre guillemets)
+            std::string text;
+            bool end;
+        };
+
+        explicit DOTLexer(ChunkReader &reader) : m_reader(reader), m_hasLookahead(false) {}
+
+        Token next() {
+            if (m_hasLookahead) {
+                m_hasLookahead = false;
+                return m_lookahead;
+            }
+            return read();
+        }
+
+        const Token& peek() {
+            if (!m_hasLookahead) {
+                m_lookahead = read();
+                m_hasLookahead = true;
+            }
+            return m_lookahead;
+        }
+
+        [[noreturn]] void error(const std::string &message) const {
+            m_reader.error(message);
+        }
+
+    private:
+        Token read() {
+            skipSpacesAndComments();
+            int c = m_reader.peek();
+            if (c == -1) {
+                return {false, "", true};
+            }
+            if (c == '"') {
+                m_reader.get();
+                std::string text;
+                while ((c = m_reader.get()) != '"') {
+                    if (c == -1) {
+                        error("chaîne non terminée");
+                    }
+                    if (c == '\\' && m_reader.peek() == '"') {
+                        c = m_reader.get();
+                    }
+                    text.push_back(c);
+                }
+                return {false, text, false};
+            }
+            if (c == '-') {
+                m_reader.get();
+                if (m_reader.peek() == '>') {
+                    m_reader.get();
+                    return {true, "->", false};
+                }
+                std::string text = "-" + readIdentifier();
+                return {false, text, false};
+            }
+            if (std::strchr("{}[]=;,", c)) {
+                m_reader.get();
+                return {true, std::string(1, c), false};
+            }
+            std::string text = readIdentifier();
+            if (text.empty()) {
+                error(std::string("caractère inattendu : ") + char(c));
+            }
+            return {false, text, false};
+        }
+
+        std::string readIdentifier() {
+            std::string text;
+            int c;
+            while ((c = m_reader.peek()) != -1 && (std::isalnum(c) || c == '_' || c == '.' || c >= 128)) {
+                text.push_back(m_reader.get());
+            }
+            return text;
+        }
+
+        void skipSpacesAndComments() {
+            int c;
+            while ((c = m_reader.peek()) != -1) {
+                if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+                    m_reader.get();
+                }
+                else if (c == '#') {
+                    m_reader.skipLine();
+                }
+                else if (c == '/') {
+                    m_reader.get();
+                    c = m_reader.get();
+                    if (c == '/') {
+                        m_reader.skipLine();
+                    }
+                    else if (c == '*') {
+                        int previous = 0;
+                        while ((c = m_reader.get()) != -1 && !(previous == '*' && c == '/')) {
+                            previous = c;
+                        }
+                    }
+                    else {
+                        error("commentaire attendu après /");
+                    }
+                }
+                else {
+                    return;
+                }
+            }
+        }
+
+        ChunkReader &m_reader;
+        Token m_lookahead;
+        bool m_hasLookahead;
+    };
+
+    typedef std::vector<std::pair<std::string, std::string>> Attributes;
+
+    /**
+     * \brief Lit une suite de listes d'attributs [a=b, c=d][e=f]
+     */
+    Attributes readAttributes(DOTLexer &lexer) {
+        Attributes attributes;
+        while (lexer.peek().symbol && lexer.peek().text == "[") {
+            lexer.next();
+            while (true) {
+                DOTLexer::Token token = lexer.next();
+                if (token.end) {
+                    lexer.error("] attendu");
+                }
+                if (token.symbol && token.text == "]") {
+                    break;
+                }
+                if (token.symbol && (token.text == "," || token.text == ";")) {
+                    continue;
+                }
+                if (token.symbol) {
+                    lexer.error("nom d'attribut attendu");
+                }
+                std::string value = "true";
+                if (lexer.peek().symbol && lexer.peek().text == "=") {
+                    lexer.next();
+                    DOTLexer::Token valueToken = lexer.next();
+                    if (valueToken.symbol || valueToken.end) {
+                        lexer.error("valeur d'attribut attendue");
+                    }
+                    value = valueToken.text;
+                }
+                attributes.emplace_back(token.text, value);
+            }
+        }
+        return attributes;
+    }
+
+    /**
+     * \brief Un sommet lu dans un fichier DOT
+     */
+    struct DOTVertex {
+        std::string name;
+        long player = -1;
+        bool square = false;
+        bool explicitTargets = false;
+        std::vector<long> targets;
+        bool red = false;
+        bool dotted = false;
+        bool init = false;
+    };
+
+    /**
+     * \brief Donne l'entier qui termine un nom de sommet (v12 -> 12) ou -1 si le nom n'est pas de cette forme
+     */
+    long numericName(const std::string &name) {
+        std::size_t i = 0;
+        while (i < name.size() && std::isalpha(static_cast<unsigned char>(name[i]))) {
+            i++;
+        }
+        if (i == name.size() || name.size() - i > 9) {
+            return -1;
+        }
+        long value = 0;
+        for ( ; i < name.size() ; i++) {
+            if (name[i] < '0' || name[i] > '9') {
+                return -1;
+            }
+            value = value * 10 + (name[i] - '0');
+        }
+        return value;
+    }
+}
+
+namespace io {
+    /**
+     * \brief Lit une liste d'arcs depuis le lecteur donné
+     */
+    static void readEdgeList(ChunkReader &reader, GameSink &sink) {
+        bool started = false;
+        std::size_t nVertices = 0, nPlayers = 0;
+        std::vector<long> weights;
+        std::vector<bool> hasSuccessor;
+
+        auto readVertex = [&]() {
+            long v = reader.readLong();
+            if (v < 0 || std::size_t(v) >= nVertices) {
+                reader.error("sommet inconnu : " + std::to_string(v));
+            }
+            return static_cast<unsigned int>(v);
+        };
+        auto readPlayer = [&]() {
+            long p = reader.readLong();
+            if (p < 0 || std::size_t(p) >= nPlayers) {
+                reader.error("joueur inconnu : " + std::to_string(p));
+            }
+            return static_cast<unsigned int>(p);
+        };
+
+        while (reader.peek() != -1) {
+            if (reader.atEndOfLine()) {
+                reader.skipLine();
+                continue;
+            }
+
+            const std::string keyword = reader.readWord();
+            if (keyword == "game") {
+                if (started) {
+                    reader.error("une seule ligne game est permise");
+                }
+                long n = reader.readLong(), p = reader.readLong(), init = reader.readLong();
+                if (n <= 0 || n > long(UINT_MAX) || p <= 0 || init < 0 || init >= n) {
+                    reader.error("ligne game invalide");
+                }
+                nVertices = n;
+                nPlayers = p;
+                weights.resize(nPlayers);
+                hasSuccessor.assign(nVertices, false);
+                sink.begin(nVertices, nPlayers, init);
+                started = true;
+            }
+            else if (!started) {
+                reader.error("la ligne game doit précéder les autres");
+            }
+            else if (keyword == "v") {
+                unsigned int v = readVertex();
+                sink.setPlayer(v, readPlayer());
+                while (!reader.atEndOfLine()) {
+                    sink.addTarget(v, readPlayer());
+                }
+            }
+            else if (keyword == "e") {
+                unsigned int from = readVertex();
+                unsigned int to = readVertex();
+                std::size_t count = 0;
+                while (!reader.atEndOfLine()) {
+                    long w = reader.readLong();
+                    if (count == nPlayers) {
+                        reader.error("trop de poids");
+                    }
+                    weights[count++] = w;
+                }
+                if (count == 1) {
+                    std::fill(weights.begin(), weights.end(), weights[0]);
+                }
+                else if (count != nPlayers) {
+                    reader.error("il faut un seul poids ou un poids par joueur");
+                }
+                sink.addEdge(from, to, weights.data());
+                hasSuccessor[from] = true;
+            }
+            else {
+                reader.error("mot-clé inconnu : " + keyword);
+            }
+
+            if (!reader.atEndOfLine()) {
+                reader.error("valeurs en trop");
+            }
+            reader.skipLine();
+        }
+
+        if (!started) {
+            throw std::runtime_error("parseEdgeList: ligne game manquante");
+        }
+        // Une partie ne peut pas s'arrêter : un sommet sans successeur bloquerait les marches et les recherches
+        auto deadEnd = std::find(hasSuccessor.begin(), hasSuccessor.end(), false);
+        if (deadEnd != hasSuccessor.end()) {
+            throw std::runtime_error("parseEdgeList: le sommet " + std::to_string(deadEnd - hasSuccessor.begin()) + " n'a aucun successeur");
+        }
+        sink.finish();
+    }
+
+    void parseEdgeList(int fd, GameSink &sink) {
+        ChunkReader reader(fd, "parseEdgeList");
+        readEdgeList(reader, sink);
+    }
+
+    void parseEdgeList(const char* data, std::size_t size, GameSink &sink) {
+        ChunkReader reader(data, size, "parseEdgeList");
+        readEdgeList(reader, sink);
+    }
+
+    void parseEdgeList(const std::string &path, GameSink &sink) {
+        InputFile file(path, "parseEdgeList");
+        parseEdgeList(file.fd, sink);
+    }
+
+    CompactGame loadEdgeList(const std::string &path) {
+        CompactGameBuilder builder;
+        parseEdgeList(path, builder);
+        return builder.getGame();
+    }
+
+    /**
+     * \brief Lit un fichier DOT depuis le lecteur donné
+     */
+    static void readDOT(ChunkReader &reader, GameSink &sink) {
+        DOTLexer lexer(reader);
+
+        std::vector<DOTVertex> vertices;
+        std::unordered_map<std::string, unsigned int> indices;
+        std::vector<unsigned int> edgeFrom, edgeTo;
+        std::vector<std::size_t> edgeWeightsStart = {0};
+        std::vector<long> edgeWeights;
+        long explicitPlayers = -1;
+
+        auto vertexIndex = [&](const std::string &name) {
+            auto itr = indices.find(name);
+            if (itr != indices.end()) {
+                return itr->second;
+            }
+            unsigned int index = vertices.size();
+            indices.emplace(name, index);
+            vertices.emplace_back();
+            vertices.back().name = name;
+            return index;
+        };
+
+        DOTLexer::Token token = lexer.next();
+        if (!token.symbol && token.text == "strict") {
+            token = lexer.next();
+        }
+        if (token.symbol || token.text != "digraph") {
+            lexer.error("seuls les digraph sont supportés");
+        }
+        if (!lexer.peek().symbol && !lexer.peek().end) {
+            lexer.next(); // Nom du graphe
+        }
+        token = lexer.next();
+        if (!token.symbol || token.text != "{") {
+            lexer.error("{ attendu");
+        }
+
+        while (true) {
+            token = lexer.next();
+            if (token.end) {
+                lexer.error("} attendu");
+            }
+            if (token.symbol && token.text == "}") {
+                break;
+            }
+            if (token.symbol && (token.text == ";" || token.text == ",")) {
+                continue;
+            }
+            if (token.symbol) {
+                lexer.error("déclaration attendue");
+            }
+            if (token.text == "subgraph") {
+                lexer.error("les sous-graphes ne sont pas supportés");
+            }
+
+            if ((token.text == "graph" || token.text == "node" || token.text == "edge") && lexer.peek().symbol && lexer.peek().text == "[") {
+                // Attributs par défaut : seul le nombre de joueurs nous intéresse
+                for (const auto &attribute : readAttributes(lexer)) {
+                    if (token.text == "graph" && attribute.first == "players") {
+                        explicitPlayers = numericName(attribute.second);
+                    }
+                }
+                continue;
+            }
+
+            if (lexer.peek().symbol && lexer.peek().text == "=") {
+                // Attribut du graphe (a = b)
+                lexer.next();
+                DOTLexer::Token value = lexer.next();
+                if (token.text == "players") {
+                    explicitPlayers = numericName(value.text);
+                }
+                continue;
+            }
+
+            std::vector<unsigned int> chain = {vertexIndex(token.text)};
+            while (lexer.peek().symbol && lexer.peek().text == "->") {
+                lexer.next();
+                DOTLexer::Token target = lexer.next();
+                if (target.symbol || target.end) {
+                    lexer.error("sommet attendu après ->");
+                }
+                chain.push_back(vertexIndex(target.text));
+            }
+            const Attributes attributes = readAttributes(lexer);
+
+            if (chain.size() == 1) {
+                DOTVertex &vertex = vertices[chain[0]];
+                for (const auto &attribute : attributes) {
+                    if (attribute.first == "player") {
+                        vertex.player = numericName(attribute.second);
+                        if (vertex.player < 0) {
+                            lexer.error("joueur invalide : " + attribute.second);
+                        }
+                    }
+                    else if (attribute.first == "shape") {
+                        vertex.square = attribute.second == "square";
+                    }
+                    else if (attribute.first == "targets") {
+                        vertex.explicitTargets = true;
+                        vertex.targets = extractIntegers(attribute.second);
+                    }
+                    else if (attribute.first == "color") {
+                        vertex.red = attribute.second == "red";
+                    }
+                    else if (attribute.first == "style") {
+                        vertex.dotted = attribute.second == "dotted";
+                    }
+                    else if (attribute.first == "init") {
+                        vertex.init = attribute.second == "true" || attribute.second == "1";
+                    }
+                }
+            }
+            else {
+                std::vector<long> weights;
+                bool explicitWeights = false;
+                for (const auto &attribute : attributes) {
+                    if (attribute.first == "weights") {
+                        weights = extractIntegers(attribute.second);
+                        explicitWeights = true;
+                    }
+                    else if (attribute.first == "label" && !explicitWeights) {
+                        weights = extractIntegers(attribute.second);
+                    }
+                }
+                for (std::size_t i = 0 ; i + 1 < chain.size() ; i++) {
+                    edgeFrom.push_back(chain[i]);
+                    edgeTo.push_back(chain[i + 1]);
+                    edgeWeights.insert(edgeWeights.end(), weights.begin(), weights.end());
+                    edgeWeightsStart.push_back(edgeWeights.size());
+                }
+            }
+        }
+
+        if (vertices.empty()) {
+            throw std::runtime_error("parseDOT: le graphe est vide");
+        }
+
+        // IDs des sommets
+        std::vector<unsigned int> ids(vertices.size());
+        std::size_t nVertices = vertices.size();
+        bool numeric = true;
+        long maxID = -1;
+        for (std::size_t i = 0 ; i < vertices.size() && numeric ; i++) {
+            long id = numericName(vertices[i].name);
+            numeric = id >= 0;
+            ids[i] = id;
+            maxID = std::max(maxID, id);
+        }
+        if (numeric) {
+            std::vector<unsigned int> sorted(ids);
+            std::sort(sorted.begin(), sorted.end());
+            numeric = std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end();
+        }
+        if (numeric) {
+            nVertices = maxID + 1;
+        }
+        else {
+            std::iota(ids.begin(), ids.end(), 0);
+        }
+
+        // Nombre de joueurs
+        std::size_t nPlayers = 1;
+        if (explicitPlayers > 0) {
+            nPlayers = explicitPlayers;
+        }
+        else {
+            for (const DOTVertex &vertex : vertices) {
+                nPlayers = std::max(nPlayers, std::size_t(vertex.player + 1));
+                if (vertex.player < 0 && vertex.square) {
+                    nPlayers = std::max<std::size_t>(nPlayers, 2);
+                }
+                for (long t : vertex.targets) {
+                    nPlayers = std::max(nPlayers, std::size_t(t + 1));
+                }
+                if (!vertex.explicitTargets && vertex.dotted) {
+                    nPlayers = std::max<std::size_t>(nPlayers, 2);
+                }
+            }
+            for (std::size_t e = 0 ; e < edgeFrom.size() ; e++) {
+                nPlayers = std::max(nPlayers, edgeWeightsStart[e + 1] - edgeWeightsStart[e]);
+            }
+        }
+
+        unsigned int init = numeric ? 0 : ids[0];
+        bool initFound = false;
+        for (std::size_t i = 0 ; i < vertices.size() ; i++) {
+            if (vertices[i].init) {
+                if (initFound) {
+                    throw std::runtime_error("parseDOT: plusieurs sommets initiaux");
+                }
+                init = ids[i];
+                initFound = true;
+            }
+        }
+        if (init >= nVertices) {
+            throw std::runtime_error("parseDOT: le sommet initial n'existe pas");
+        }
+
+        sink.begin(nVertices, nPlayers, init);
+        for (std::size_t i = 0 ; i < vertices.size() ; i++) {
+            const DOTVertex &vertex = vertices[i];
+            long player = vertex.player >= 0 ? vertex.player : (vertex.square ? 1 : 0);
+            if (std::size_t(player) >= nPlayers) {
+                throw std::runtime_error("parseDOT: joueur inconnu pour " + vertex.name);
+            }
+            sink.setPlayer(ids[i], player);
+
+            std::vector<long> targets = vertex.targets;
+            if (!vertex.explicitTargets) {
+                if (vertex.red) {
+                    targets.push_back(0);
+                }
+                if (vertex.dotted) {
+                    targets.push_back(1);
+                }
+            }
+            for (long t : targets) {
+                if (t < 0 || std::size_t(t) >= nPlayers) {
+                    throw std::runtime_error("parseDOT: joueur inconnu dans les cibles de " + vertex.name);
+                }
+                sink.addTarget(ids[i], t);
+            }
+        }
+
+        // Une partie ne peut pas s'arrêter : chaque sommet, y compris ceux dont l'ID n'est pas déclaré, doit avoir un successeur
+        std::vector<bool> hasSuccessor(nVertices, false);
+        for (std::size_t e = 0 ; e < edgeFrom.size() ; e++) {
+            hasSuccessor[ids[edgeFrom[e]]] = true;
+        }
+        auto deadEnd = std::find(hasSuccessor.begin(), hasSuccessor.end(), false);
+        if (deadEnd != hasSuccessor.end()) {
+            const std::size_t id = deadEnd - hasSuccessor.begin();
+            auto vertex = std::find(ids.begin(), ids.end(), id);
+            if (vertex == ids.end()) {
+                throw std::runtime_error("parseDOT: le sommet d'ID " + std::to_string(id) + " n'est pas déclaré");
+            }
+            throw std::runtime_error("parseDOT: le sommet " + vertices[vertex - ids.begin()].name + " n'a aucun successeur");
+        }
+
+        // Les arcs sont envoyés triés selon leur sommet de départ pour que tous les récepteurs les acceptent
+        std::vector<std::size_t> order(edgeFrom.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return ids[edgeFrom[a]] < ids[edgeFrom[b]]; });
+        std::vector<long> weights(nPlayers);
+        for (std::size_t e : order) {
+            const std::size_t count = edgeWeightsStart[e + 1] - edgeWeightsStart[e];
+            if (count == 0) {
+                std::fill(weights.begin(), weights.end(), 1);
+            }
+            else if (count == 1) {
+                std::fill(weights.begin(), weights.end(), edgeWeights[edgeWeightsStart[e]]);
+            }
+            else if (count == nPlayers) {
+                std::copy(edgeWeights.begin() + edgeWeightsStart[e], edgeWeights.begin() + edgeWeightsStart[e + 1], weights.begin());
+            }
+            else {
+                throw std::runtime_error("parseDOT: l'arc " + vertices[edgeFrom[e]].name + " -> " + vertices[edgeTo[e]].name + " doit avoir un seul poids ou un poids par joueur");
+            }
+            sink.addEdge(ids[edgeFrom[e]], ids[edgeTo[e]], weights.data());
+        }
+        sink.finish();
+    }
+
+    void parseDOT(int fd, GameSink &sink) {
+        ChunkReader reader(fd, "parseDOT");
+        readDOT(reader, sink);
+    }
+
+    void parseDOT(const char* data, std::size_t size, GameSink &sink) {
+        ChunkReader reader(data, size, "parseDOT");
+        readDOT(reader, sink);
+    }
+
+    void parseDOT(const std::string &path, GameSink &sink) {
+        InputFile file(path, "parseDOT");
+        parseDOT(file.fd, sink);
+    }
+
+    CompactGame loadDOT(const std::string &path) {
+        CompactGameBuilder builder;
+        parseDOT(path, builder);
+        return builder.getGame();
+    }
+
+    CompactGame loadTextGame(const std::string &path) {
+        std::string start;
+        {
+            InputFile file(path, "loadTextGame");
+            char buffer[256];
+            ssize_t n = read(file.fd, buffer, sizeof(buffer));
+            if (n > 0) {
+                start.assign(buffer, n);
+            }
+        }
+        std::size_t first = start.find_first_not_of(" \t\r\n");
+        if (first != std::string::npos && (start.compare(first, 7, "digraph") == 0 || start.compare(first, 6, "strict") == 0 || start.compare(first, 2, "//") == 0 || start.compare(first, 2, "/*") == 0)) {
+            return loadDOT(path);
+        }
+        return loadEdgeList(path);
+    }
+}
\ No newline at end of file
@@ -16,25 +16,316 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
 
-#include "Vertex.hpp"
-#include "Graph.hpp"
-#include "Player.hpp"
+#include <sys/resource.h>
+
+#include "CompactGame.hpp"
 #include "ReachabilityGame.hpp"
-#include "MinMaxGame.hpp"
 #include "exploration/BestFirstSearch.hpp"
+#include "exploration/Engines.hpp"
 #include "exploration/RandomPaths.hpp"
-#include "generators/RandomTreeLikeGenerator.hpp"
-#include "generators/RandomGenerator.hpp"
-#include "generators/RandomStronglyConnectedGenerator.hpp"
+#include "io/BinaryGame.hpp"
+#include "io/BufferedWriter.hpp"
+#include "io/Results.hpp"
+#include "io/SolverDaemon.hpp"
+#include "io/TextGame.hpp"
+#include "types/ThreadPool.hpp"
 
 using namespace exploration;
 using namespace types;
-using namespace std::placeholders;
 
-int main() {
-    ReachabilityGame game = generators::randomTreeLikeGenerator(3, 1, 1, 0.0000000000000000001, 0, 0, 0, -10, 0, false, 2, false, {0.3, 0.7});
+namespace {
+    /**
+     * \brief Les options de la ligne de commande
+     */
+    struct Options {
+        std::string engine = "astar";
+        EngineOptions engineOptions;
+        std::size_t nThreads = 0;
+        std::size_t processMemory = 0; // En Mo, pour tout le processus, 0 pour aucune limite
+        std::string output;
+        std::string daemon;
+        std::vector<std::string> inputs;
+        bool patternsCache = false;
+        bool listEngines = false;
+        bool help = false;
+    };
+
+    void usage(std::ostream &os) {
+        os << "Utilisation : ReachabilityGame [options] <fichier ou dossier>...\n"
+           << "            ReachabilityGame [options] --daemon <socket>\n"
+           << "Résout chaque jeu (format binaire .rgb, DOT ou liste d'arcs) et écrit une ligne JSON par jeu.\n"
+           << "Les dossiers sont parcourus récursivement.\n"
+           << "Avec --daemon, attend les requêtes (load, game, warm, solve, unload, list, quit, shutdown) sur un socket Unix.\n\n"
+           << "Options :\n"
+           << "  --engine <nom>     Le moteur de résolution (astar par défaut)\n"
+           << "  --list-engines     Affiche les moteurs disponibles\n"
+           << "  --time <s>         Le temps permis par jeu, en secondes (pas de limite par défaut)\n"
+           << "  --process-memory <Mo> La mémoire permise pour tout le processus, partagée par les jeux résolus en même temps (pas de limite par défaut)\n"
+           << "  --threads <n>      Le nombre de jeux résolus en même temps (nombre de coeurs par défaut)\n"
+           << "  --paths <n>        Le nombre de chemins des moteurs aléatoires (1000 par défaut)\n"
+           << "  --engine-threads <n> Le nombre de threads des moteurs parallèles et des valeurs de coalition des gros jeux, pour chaque jeu (1 par défaut)\n"
+           << "  --beam-width <n>   Le nombre de noeuds gardés par profondeur du moteur beam (1000 par défaut)\n"
+           << "  --tie-breaking <r> Le départage des noeuds de même coût : depth (par défaut), reached ou h\n"
+           << "  --symmetries       Confond les états symétriques dans astar, uniform et patterns (la recherche des symétries coûte cher sur les gros jeux)\n"
+           << "  --patterns-cache   Garde la base de motifs du moteur patterns dans <jeu>.pdb, à côté de chaque jeu\n"
+           << "  --output <fichier> Où écrire les résultats (sortie standard par défaut)\n"
+           << "  --daemon <socket>  Résout les jeux demandés sur le socket au lieu des fichiers\n"
+           << "  --help             Affiche ce message\n";
+    }
+
+    std::size_t parseCount(const std::string &option, const std::string &value) {
+        std::size_t used = 0;
+        unsigned long result = 0;
+        try {
+            result = std::stoul(value, &used);
+        }
+        catch (const std::logic_error&) {
+            used = 0;
+        }
+        if (used != value.size() || value.empty() || value[0] == '-') {
+            throw std::runtime_error(option + " attend un entier positif, pas " + value);
+        }
+        return result;
+    }
+
+    Options parseArguments(int argc, char* argv[]) {
+        Options options;
+        for (int i = 1 ; i < argc ; i++) {
+            const std::string argument = argv[i];
+            auto value = [&]() {
+                if (i + 1 >= argc) {
+                    throw std::runtime_error(argument + " attend une valeur");
+                }
+                return std::string(argv[++i]);
+            };
+
+            if (argument == "--engine") {
+                options.engine = value();
+            }
+            else if (argument == "--list-engines") {
+                options.listEngines = true;
+            }
+            else if (argument == "--time") {
+                options.engineOptions.allowedTime = Long(long(parseCount(argument, value())));
+            }
+            else if (argument == "--process-memory") {
+                options.processMemory = parseCount(argument, value());
+            }
+            else if (argument == "--threads") {
+                options.nThreads = parseCount(argument, value());
+            }
+            else if (argument == "--paths") {
+                options.engineOptions.nPaths = parseCount(argument, value());
+            }
+            else if (argument == "--engine-threads") {
+                options.engineOptions.nThreads = parseCount(argument, value());
+            }
+            else if (argument == "--beam-width") {
+                options.engineOptions.beamWidth = parseCount(argument, value());
+            }
+            else if (argument == "--tie-breaking") {
+                options.engineOptions.tieBreaking = parseTieBreaking(value());
+            }
+            else if (argument == "--symmetries") {
+                options.engineOptions.symmetries = true;
+            }
+            else if (argument == "--patterns-cache") {
+                options.patternsCache = true;
+            }
+            else if (argument == "--output") {
+                options.output = value();
+            }
+            else if (argument == "--daemon") {
+                options.daemon = value();
+            }
+            else if (argument == "--help" || argument == "-h") {
+                options.help = true;
+            }
+            else if (argument.size() > 1 && argument[0] == '-') {
+                throw std::runtime_error("option inconnue : " + argument);
+            }
+            else {
+                options.inputs.push_back(argument);
+            }
+        }
+        return options;
+    }
+
+    /**
+     * \brief Donne la liste (triée) des fichiers à résoudre
+     */
+    std::vector<std::string> collectFiles(const std::vector<std::string> &inputs) {
+        namespace fs = std::filesystem;
+        std::vector<std::string> files;
+        for (const std::string &input : inputs) {
+            if (fs::is_directory(input)) {
+                std::vector<std::string> inDirectory;
+                for (const auto &entry : fs::recursive_directory_iterator(input)) {
+                    if (entry.is_regular_file() && entry.path().filename().string()[0] != '.') {
+                        inDirectory.push_back(entry.path().string());
+                    }
+                }
+                std::sort(inDirectory.begin(), inDirectory.end());
+                files.insert(files.end(), inDirectory.begin(), inDirectory.end());
+            }
+            else {
+                files.push_back(input);
+            }
+        }
+        return files;
+    }
+
+    /**
+     * \brief Charge et résout un jeu
+     * \param status Le résultat (ok, timeout, no_equilibrium, out_of_memory ou error)
+     * \return La ligne JSON qui décrit le résultat
+     */
+    std::string solve(std::size_t index, const std::string &file, const Options &options, std::string &status) {
+        std::string line = "{\"index\":" + std::to_string(index) + ",\"file\":\"" + io::escapeJSON(file) + "\",\"engine\":\"" + io::escapeJSON(options.engine) + "\"";
+        std::string details, message;
+        const auto start = std::chrono::steady_clock::now();
+        auto solveStart = start;
+
+        try {
+            const CompactGame compact = io::loadGame(file);
+            line += ",\"vertices\":" + std::to_string(compact.size()) + ",\"edges\":" + std::to_string(compact.getNumberEdges()) + ",\"players\":" + std::to_string(compact.getNumberPlayers());
+
+            ReachabilityGame game = compact.toReachabilityGame();
+            solveStart = std::chrono::steady_clock::now();
+            line += ",\"load_ms\":" + io::millisecondsToJSON(solveStart - start);
+
+            EngineOptions engineOptions = options.engineOptions;
+            if (options.patternsCache) {
+                engineOptions.patternsFile = file + ".pdb";
+            }
+            const io::SolveResult result = io::runEngine(findEngine(options.engine), game, engineOptions);
+            status = result.status;
+            message = result.message;
+            if (!result.details.empty()) {
+                details = "," + result.details;
+            }
+        }
+        catch (const std::bad_alloc &e) {
+            status = "out_of_memory";
+            message = "mémoire insuffisante";
+        }
+        catch (const std::exception &e) {
+            status = "error";
+            message = e.what();
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        line += ",\"status\":\"" + status + "\",\"solve_ms\":" + io::millisecondsToJSON(end - solveStart) + ",\"total_ms\":" + io::millisecondsToJSON(end - start) + details;
+        if (!message.empty()) {
+            line += ",\"message\":\"" + io::escapeJSON(message) + "\"";
+        }
+        line += "}\n";
+        return line;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        options = parseArguments(argc, argv);
+        if (!options.listEngines && !options.help) {
+            findEngine(options.engine);
+        }
+    }
+    catch (const std::runtime_error &e) {
+        std::cerr << e.what() << "\n\n";
+        usage(std::cerr);
+        return 1;
+    }
+
+    if (options.help) {
+        usage(std::cout);
+        return 0;
+    }
+    if (options.listEngines) {
+        for (const auto &engine : engines()) {
+            std::cout << engine.first << '\n';
+        }
+        return 0;
+    }
+    if (options.inputs.empty() && options.daemon.empty()) {
+        usage(std::cerr);
+        return 1;
+    }
+
+    if (options.processMemory != 0) {
+        // La limite porte sur tout le processus, pas sur chaque jeu : le jeu dont une allocation échoue est signalé (out_of_memory) et les autres continuent
+        rlimit limit;
+        limit.rlim_cur = limit.rlim_max = rlim_t(options.processMemory) << 20;
+        if (setrlimit(RLIMIT_AS, &limit) != 0) {
+            std::cerr << "Impossible de limiter la mémoire\n";
+            return 1;
+        }
+    }
+
+    if (!options.daemon.empty()) {
+        try {
+            io::SolverDaemon daemon(options.daemon, options.nThreads);
+            daemon.run();
+        }
+        catch (const std::exception &e) {
+            std::cerr << e.what() << '\n';
+            return 1;
+        }
+        return 0;
+    }
+
+    std::vector<std::string> files;
+    try {
+        files = collectFiles(options.inputs);
+    }
+    catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+
+    std::unique_ptr<io::BufferedWriter> writer;
+    try {
+        writer = options.output.empty() ? std::make_unique<io::BufferedWriter>(1) : std::make_unique<io::BufferedWriter>(options.output);
+    }
+    catch (const std::runtime_error &e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+
+    std::mutex mutex;
+    std::map<std::string, std::size_t> statuses;
+    const auto start = std::chrono::steady_clock::now();
+
+    ThreadPool pool(options.nThreads);
+    parallelFor(pool, files.size(), [&](std::size_t i, std::size_t) {
+        std::string status;
+        const std::string line = solve(i, files[i], options, status);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        statuses[status]++;
+        writer->write(line);
+        writer->flush();
+    });
+
+    std::string summary = "{\"summary\":true,\"engine\":\"" + io::escapeJSON(options.engine) + "\",\"games\":" + std::to_string(files.size()) + ",\"threads\":" + std::to_string(pool.size());
+    for (const auto &status : statuses) {
+        summary += ",\"" + status.first + "\":" + std::to_string(status.second);
+    }
+    summary += ",\"total_ms\":" + io::millisecondsToJSON(std::chrono::steady_clock::now() - start) + "}\n";
+    writer->write(summary);
+    writer->flush();
 
-    std::cout << game << '\n';
+    return 0;
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "types/AliasTable.hpp"
+
+#include <vector>
+
+namespace types {
+    namespace aliasTable {
+        void build(const double* weights, std::size_t n, float* probabilities, unsigned int* aliases) {
+            double total = 0;
+            for (std::size_t i = 0 ; i < n ; i++) {
+                total += weights[i];
+            }
+
+            // Les probabilités mises à l'échelle : en moyenne 1
+            std::vector<double> scaled(n);
+            std::vector<unsigned int> small, large;
+            small.reserve(n);
+            large.reserve(n);
+            for (std::size_t i = 0 ; i < n ; i++) {
+                scaled[i] = weights[i] * double(n) / total;
+                aliases[i] = static_cast<unsigned int>(i);
+                (scaled[i] < 1. ? small : large).push_back(static_cast<unsigned int>(i));
+            }
+
+            // Chaque petite entrée est complétée par une grande, qui perd ce qu'elle donne
+            while (!small.empty() && !large.empty()) {
+                const unsigned int s = small.back(), l = large.back();
+                small.pop_back();
+                probabilities[s] = float(scaled[s]);
+                aliases[s] = l;
+                scaled[l] -= 1. - scaled[s];
+                if (scaled[l] < 1.) {
+                    large.pop_back();
+                    small.push_back(l);
+                }
+            }
+            // Ce qui reste vaut 1 (aux erreurs d'arrondi près)
+            for (unsigned int i : large) {
+                probabilities[i] = 1.f;
+            }
+            for (unsigned int i : small) {
+                probabilities[i] = 1.f;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "catch.hpp"
+
+#include "algorithms/CondensedMinMax.hpp"
+#include "generators/RandomGenerator.hpp"
+#include "MinMaxGame.hpp"
+
+using namespace algorithms;
+using namespace types;
+
+TEST_CASE("Valeurs de coalition par composantes", "[algorithms]") {
+    SECTION("Exemple du mémoire") {
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 1, 2);
+        Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 2);
+        Vertex::Ptr v2 = std::make_shared<Vertex>(2, 1, 2);
+        Vertex::Ptr v3 = std::make_shared<Vertex>(3, 0, 2);
+        Vertex::Ptr v4 = std::make_shared<Vertex>(4, 0, 2);
+        Vertex::Ptr v5 = std::make_shared<Vertex>(5, 1, 2);
+        Vertex::Ptr v6 = std::make_shared<Vertex>(6, 0, 2);
+        Vertex::Ptr v7 = std::make_shared<Vertex>(7, 1, 2);
+
+        v0->addSuccessor(v0, 1);
+        v1->addSuccessor(v0, 1);
+        v2->addSuccessor(v0, 1);
+        v2->addSuccessor(v1, 1);
+        v3->addSuccessor(v0, 5);
+        v3->addSuccessor(v2, 1);
+        v4->addSuccessor(v2, 5);
+        v4->addSuccessor(v3, 1);
+        v5->addSuccessor(v4, 1);
+        v5->addSuccessor(v6, 1);
+        v6->addSuccessor(v7, 1);
+        v7->addSuccessor(v6, 1);
+
+        Graph g({v0, v1, v2, v3, v4, v5, v6, v7}, 2);
+        Player p1(0, {v1, v3, v4, v6}, {v0});
+        Player p2(1, {v0, v2, v5, v7}, {});
+        v0->addTargetFor(0);
+        ReachabilityGame game(g, v0, {p1, p2});
+
+        const CondensedMinMax solver(CompactGame::fromReachabilityGame(game));
+        // v0 (boucle), v6 et v7 (cycle) et les cinq autres sommets seuls
+        REQUIRE(solver.getNumberComponents() == 7);
+        REQUIRE(solver.getNumberLevels() == 6);
+
+        const std::vector<Long> values = solver.solve(0);
+        const std::vector<Long> expected{0, 1, 2, 3, 4, Long::infinity, Long::infinity, Long::infinity};
+        REQUIRE(values == expected);
+        REQUIRE(game.getCoalitionValues(0) == expected);
+        REQUIRE(solver.solve(1) == std::vector<Long>(8, Long::infinity));
+    }
+
+    SECTION("Comme DijkstraMinMax sur des jeux aléatoires") {
+        std::default_random_engine generator(17);
+        for (std::size_t i = 0 ; i < 30 ; i++) {
+            // Peu de successeurs : beaucoup de petites composantes
+            ReachabilityGame game = generators::randomGenerator(60, 1, i % 3 + 1, 0, 6, true, 3, false, {1./3, 1./3, 1./3}, {0.05, 0.05, 0.05}, {Long::infinity, Long::infinity, Long::infinity}, generator);
+            const CompactGame compact = CompactGame::fromReachabilityGame(game);
+            const CondensedMinMax sequential(compact), parallel(compact, 3);
+            REQUIRE(sequential.getNumberLevels() == parallel.getNumberLevels());
+
+            for (unsigned int p = 0 ; p < 3 ; p++) {
+                const std::vector<Long> expected = MinMaxGame::convert(game, p).getValues(game.getPlayers()[p].getGoals());
+                REQUIRE(sequential.solve(p) == expected);
+                REQUIRE(parallel.solve(p) == expected);
+                REQUIRE(game.getCoalitionValues(p) == expected);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include "algorithms/IncrementalComponents.hpp"
+#include "generators/RandomStronglyConnectedGenerator.hpp"
+
+using namespace algorithms;
+
+TEST_CASE("Composantes incrémentales", "[algorithms]") {
+    SECTION("Fusions successives") {
+        // Quatre sommets sans arc : quatre composantes
+        std::vector<std::size_t> offsets(5, 0);
+        ComponentIndex index = tarjanIterative(4, offsets.data(), nullptr);
+
+        IncrementalComponents components(index);
+        REQUIRE(components.size() == 4);
+
+        std::size_t merged = components.merge(components.positionOf(0), components.positionOf(1));
+        REQUIRE(components.size() == 3);
+        REQUIRE(components.positionOf(0) == merged);
+        REQUIRE(components.positionOf(1) == merged);
+        REQUIRE(components.getComponent(merged).size() == 2);
+        REQUIRE(components.positionOf(2) != merged);
+
+        merged = components.merge(components.positionOf(3), components.positionOf(1));
+        REQUIRE(components.size() == 2);
+        REQUIRE(components.getComponent(merged).size() == 3);
+        REQUIRE(components.positionOf(3) == components.positionOf(0));
+
+        merged = components.merge(0, 1);
+        REQUIRE(components.size() == 1);
+        REQUIRE(components.getComponent(0).size() == 4);
+
+        REQUIRE_THROWS(components.merge(0, 0));
+    }
+
+    SECTION("Le générateur produit un graphe fortement connexe") {
+        std::size_t size = 2000;
+        ReachabilityGame game = generators::randomStronglyConnectedGenerator(size, 1, 2, 2, false);
+
+        REQUIRE(game.getGraph().size() == size);
+        REQUIRE(tarjanIterative(game.getGraph()).size() == 1);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "catch.hpp"
+
+#include "algorithms/MinMaxValues.hpp"
+#include "generators/RandomGenerator.hpp"
+#include "MinMaxGame.hpp"
+
+using namespace algorithms;
+using namespace types;
+
+TEST_CASE("Valeurs de coalition avec des poids négatifs", "[algorithms]") {
+    Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 1);
+    Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 1);
+    Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 1);
+    Vertex::Ptr v3 = std::make_shared<Vertex>(3, 0, 1);
+    v3->addSuccessor(v3, 0);
+
+    SECTION("Potentiels") {
+        // v1 appartient à la coalition
+        v1 = std::make_shared<Vertex>(1, 1, 2);
+        v0 = std::make_shared<Vertex>(0, 0, 2);
+        v2 = std::make_shared<Vertex>(2, 0, 2);
+        v3 = std::make_shared<Vertex>(3, 0, 2);
+        v0->addSuccessor(v1, -2);
+        v0->addSuccessor(v3, 4);
+        v1->addSuccessor(v3, 1);
+        v1->addSuccessor(v2, 2);
+        v2->addSuccessor(v3, -1);
+        v3->addSuccessor(v0, -5);
+        Graph g({v0, v1, v2, v3}, 2);
+        Player p1(0, {v0, v2, v3}, {v3});
+        Player p2(1, {v1}, {});
+        v3->addTargetFor(0);
+        ReachabilityGame game(g, v0, {p1, p2});
+
+        const CompactGame compact = CompactGame::fromReachabilityGame(game);
+        REQUIRE(hasNegativeWeights(compact, 0));
+
+        std::vector<long> potentials;
+        REQUIRE(computePotentials(compact, 0, potentials));
+        for (unsigned int u = 0 ; u < 3 ; u++) {
+            for (std::size_t e = compact.beginEdges(u) ; e < compact.endEdges(u) ; e++) {
+                REQUIRE(compact.getWeights(e)[0] + potentials[u] - potentials[compact.getSuccessor(e)] >= 0);
+            }
+        }
+
+        MinMaxEngine engine;
+        const std::vector<Long> expected{-1, 1, -1, 0};
+        REQUIRE(solveMinMax(CondensedMinMax(compact), 0, &engine) == expected);
+        REQUIRE(engine == MinMaxEngine::Potentials);
+        REQUIRE(valueIterationMinMax(compact, 0) == expected);
+        REQUIRE(game.getCoalitionValues(0) == expected);
+    }
+
+    SECTION("Cycle négatif") {
+        v0->addSuccessor(v1, -2);
+        v1->addSuccessor(v0, 1);
+        v1->addSuccessor(v3, 3);
+        v2->addSuccessor(v2, -1);
+        Graph g({v0, v1, v2, v3}, 1);
+        Player p(0, {v0, v1, v2, v3}, {v3});
+        v3->addTargetFor(0);
+        ReachabilityGame game(g, v0, {p});
+
+        // Le joueur tourne autant qu'il veut dans v0 -> v1 -> v0 ; v2 n'atteint jamais la cible
+        const CompactGame compact = CompactGame::fromReachabilityGame(game);
+        std::vector<long> potentials;
+        REQUIRE_FALSE(computePotentials(compact, 0, potentials));
+
+        MinMaxEngine engine;
+        const std::vector<Long> expected{-Long::infinity, -Long::infinity, Long::infinity, 0};
+        REQUIRE(solveMinMax(CondensedMinMax(compact), 0, &engine) == expected);
+        REQUIRE(engine == MinMaxEngine::ValueIteration);
+        REQUIRE(game.getCoalitionValues(0) == expected);
+    }
+
+    SECTION("Cycle négatif de la coalition") {
+        // La coalition préfère tourner sans fin plutôt que laisser le joueur atteindre sa cible
+        CompactGameBuilder builder;
+        builder.begin(3, 2, 0);
+        builder.setPlayer(1, 1);
+        builder.addTarget(2, 0);
+        const long w01[] = {-2, 0}, w10[] = {1, 0}, w12[] = {3, 0}, w22[] = {0, 0};
+        builder.addEdge(0, 1, w01);
+        builder.addEdge(1, 0, w10);
+        builder.addEdge(1, 2, w12);
+        builder.addEdge(2, 2, w22);
+        builder.finish();
+
+        MinMaxEngine engine;
+        REQUIRE(solveMinMax(CondensedMinMax(builder.getGame()), 0, &engine) == std::vector<Long>{Long::infinity, Long::infinity, 0});
+        REQUIRE(engine == MinMaxEngine::ValueIteration);
+    }
+
+    SECTION("Jeux aléatoires") {
+        std::default_random_engine generator(5);
+        std::size_t counts[3] = {0, 0, 0};
+        for (std::size_t i = 0 ; i < 40 ; i++) {
+            const long minWeight = i < 10 ? 0 : -long(i % 3);
+            ReachabilityGame game = generators::randomGenerator(40, 1, 3, minWeight, 8, true, 2, false, {0.5, 0.5}, {0.1, 0.1}, {Long::infinity, Long::infinity}, generator);
+            const CondensedMinMax condensed(CompactGame::fromReachabilityGame(game));
+            for (unsigned int p = 0 ; p < 2 ; p++) {
+                MinMaxEngine engine;
+                const std::vector<Long> values = solveMinMax(condensed, p, &engine);
+                counts[int(engine)]++;
+                REQUIRE(values == valueIterationMinMax(condensed.getGame(), p));
+                if (engine == MinMaxEngine::Dijkstra) {
+                    REQUIRE(values == MinMaxGame::convert(game, p).getValues(game.getPlayers()[p].getGoals()));
+                }
+            }
+        }
+        REQUIRE(counts[int(MinMaxEngine::Dijkstra)] > 0);
+        REQUIRE(counts[int(MinMaxEngine::Potentials)] > 0);
+        REQUIRE(counts[int(MinMaxEngine::ValueIteration)] > 0);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "catch.hpp"
+
+#include "algorithms/Symmetries.hpp"
+#include "exploration/BestFirstSearch.hpp"
+#include "exploration/Heuristics.hpp"
+#include "ReachabilityGame.hpp"
+
+using namespace algorithms;
+using namespace exploration;
+using namespace types;
+
+TEST_CASE("Symétries", "[algorithms]") {
+    SECTION("Échange de deux joueurs") {
+        // v2 et v3 jouent le même rôle pour les joueurs 0 et 1, comme v0 et v1
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+        Vertex::Ptr v1 = std::make_shared<Vertex>(1, 1, 2);
+        Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 2);
+        Vertex::Ptr v3 = std::make_shared<Vertex>(3, 1, 2);
+        v2->addSuccessor(v0, 1);
+        v2->addSuccessor(v3, 1);
+        v3->addSuccessor(v1, 1);
+        v3->addSuccessor(v2, 1);
+        v0->addSuccessor(v0, 1);
+        v1->addSuccessor(v1, 1);
+        v0->addTargetFor(0);
+        v1->addTargetFor(1);
+        Graph g({v0, v1, v2, v3}, 2);
+        Player p1(0, {v0, v2}, {v0});
+        Player p2(1, {v1, v3}, {v1});
+
+        SECTION("Symétrique") {
+            ReachabilityGame game(g, v2, {p1, p2});
+            const Symmetries symmetries(game);
+            REQUIRE(symmetries.getAutomorphisms().size() == 1);
+            const Automorphism &swap = symmetries.getAutomorphisms()[0];
+            REQUIRE(swap.vertices == std::vector<unsigned int>{1, 0, 3, 2});
+            REQUIRE(swap.players == std::vector<unsigned int>{1, 0});
+            REQUIRE(symmetries.getVertexColours()[0] == symmetries.getVertexColours()[1]);
+            REQUIRE(symmetries.getPlayerColours()[0] == symmetries.getPlayerColours()[1]);
+        }
+
+        SECTION("Poids différents") {
+            v2->addSuccessor(v0, 2);
+            ReachabilityGame game(g, v2, {p1, p2});
+            const Symmetries symmetries(game);
+            REQUIRE(symmetries.empty());
+            REQUIRE(symmetries.getVertexColours()[0] != symmetries.getVertexColours()[1]);
+        }
+    }
+
+    SECTION("Branches interchangeables") {
+        // Trois branches identiques de v0 vers v4 : le groupe des permutations des branches a 6 éléments
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+        Vertex::Ptr v1 = std::make_shared<Vertex>(1, 1, 2);
+        Vertex::Ptr v2 = std::make_shared<Vertex>(2, 1, 2);
+        Vertex::Ptr v3 = std::make_shared<Vertex>(3, 1, 2);
+        Vertex::Ptr v4 = std::make_shared<Vertex>(4, 0, 2);
+        Vertex::Ptr v5 = std::make_shared<Vertex>(5, 1, 2);
+        for (const Vertex::Ptr &branch : {v1, v2, v3}) {
+            v0->addSuccessor(branch, 1);
+            branch->addSuccessor(v4, 2);
+            branch->addSuccessor(v0, 1);
+        }
+        v4->addSuccessor(v5, 1);
+        v4->addSuccessor(v0, 1);
+        v5->addSuccessor(v5, 0);
+        v4->addTargetFor(0);
+        v5->addTargetFor(1);
+        Graph g({v0, v1, v2, v3, v4, v5}, 2);
+        Player p1(0, {v0, v4}, {v4});
+        Player p2(1, {v1, v2, v3, v5}, {v5});
+        ReachabilityGame game(g, v0, {p1, p2});
+
+        const Symmetries &symmetries = game.getSymmetries();
+        REQUIRE(&symmetries == &game.getSymmetries());
+        REQUIRE(symmetries.getAutomorphisms().size() == 5);
+        for (const Automorphism &automorphism : symmetries.getAutomorphisms()) {
+            REQUIRE(automorphism.players == std::vector<unsigned int>{0, 1});
+            REQUIRE(automorphism.vertices[0] == 0);
+            REQUIRE(automorphism.vertices[4] == 4);
+            REQUIRE(automorphism.vertices[5] == 5);
+        }
+
+        SECTION("Limite du groupe") {
+            REQUIRE(Symmetries(game, 2).getAutomorphisms().size() == 2);
+            REQUIRE(Symmetries(game, 256, 0).empty());
+        }
+
+        SECTION("Clés canoniques") {
+            auto makeNode = [&](const Vertex::Ptr &branch) {
+                Path path(game, v0);
+                path.addStep(branch);
+                Node node(2, path);
+                updateBound(node, game);
+                return node;
+            };
+            const Node n1 = makeNode(v1), n3 = makeNode(v3);
+            REQUIRE(transpositionKey(n1) != transpositionKey(n3));
+            REQUIRE(transpositionKey(n1, symmetries) == transpositionKey(n3, symmetries));
+        }
+
+        SECTION("Exploration") {
+            // Une seule des trois branches est développée
+            SearchStatistics statistics;
+            const Path path = bestFirstSearch(game, heuristics::Zero(), Long::infinity, &statistics, TieBreaking::Deepest, true);
+            REQUIRE(path.isANashEquilibrium());
+            REQUIRE(path.getCosts()[0] == std::make_pair(true, Long(3)));
+            REQUIRE(path.getCosts()[1] == std::make_pair(true, Long(4)));
+            REQUIRE(statistics.symmetries == 5);
+            REQUIRE(statistics.pruned >= 2);
+            REQUIRE(statistics.symmetriesTime > std::chrono::steady_clock::duration::zero());
+
+            // Par défaut, les symétries ne sont pas cherchées
+            SearchStatistics without;
+            const Path other = bestFirstSearch(game, heuristics::Zero(), Long::infinity, &without);
+            REQUIRE(other.getCosts() == path.getCosts());
+            REQUIRE(without.symmetries == 0);
+            REQUIRE(without.symmetriesTime == std::chrono::steady_clock::duration::zero());
+            REQUIRE(without.expanded > statistics.expanded);
+        }
+    }
+}
\ No newline at end of file
@@ -145,4 +145,74 @@ TEST_CASE("Algorithme de Tarjan", "[algorithms]") {
         REQUIRE(components.find({4}) != components.end());
         REQUIRE(components.find({0, 1, 2, 3}) != components.end());
     }
+}
+
+TEST_CASE("Algorithme de Tarjan itératif", "[algorithms]") {
+    SECTION("Deux composantes reliées par un arc") {
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+        Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 2);
+        Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 2);
+        Vertex::Ptr v3 = std::make_shared<Vertex>(3, 0, 2);
+        Vertex::Ptr v4 = std::make_shared<Vertex>(4, 0, 2);
+
+        v0->addSuccessor(v1, 0);
+        v1->addSuccessor(v0, 0);
+        v1->addSuccessor(v2, 0);
+        v2->addSuccessor(v3, 0);
+        v3->addSuccessor(v4, 0);
+        v4->addSuccessor(v2, 0);
+
+        std::vector<Vertex::Ptr> vertices{v0, v1, v2, v3, v4};
+
+        Graph graph(vertices, {0, 0});
+
+        algorithms::ComponentIndex index = algorithms::tarjanIterative(graph);
+
+        REQUIRE(index.size() == 2);
+        REQUIRE(index.componentOf[0] == index.componentOf[1]);
+        REQUIRE(index.componentOf[2] == index.componentOf[3]);
+        REQUIRE(index.componentOf[3] == index.componentOf[4]);
+        REQUIRE(index.componentOf[0] != index.componentOf[2]);
+        // Ordre topologique inverse : {2, 3, 4} est terminée avant {0, 1}
+        REQUIRE(index.componentOf[2] < index.componentOf[0]);
+
+        for (std::size_t c = 0 ; c < index.size() ; c++) {
+            for (std::size_t i = index.offsets[c] ; i < index.offsets[c + 1] ; i++) {
+                REQUIRE(index.componentOf[index.members[i]] == c);
+            }
+        }
+        REQUIRE(index.componentSize(index.componentOf[0]) == 2);
+        REQUIRE(index.componentSize(index.componentOf[2]) == 3);
+    }
+
+    SECTION("Une très longue chaîne ne fait pas déborder la pile") {
+        const std::size_t size = 2000000;
+        std::vector<std::size_t> offsets(size + 1);
+        std::vector<unsigned int> successors(size);
+        for (std::size_t v = 0 ; v < size ; v++) {
+            offsets[v] = v;
+            // Chaîne 0 -> 1 -> ... -> size-1 -> 0
+            successors[v] = (v + 1) % size;
+        }
+        offsets[size] = size;
+
+        SECTION("Un cycle") {
+            algorithms::ComponentIndex index = algorithms::tarjanIterative(size, offsets.data(), successors.data());
+
+            REQUIRE(index.size() == 1);
+            REQUIRE(index.componentSize(0) == size);
+        }
+
+        SECTION("Une chaîne sans retour") {
+            successors.pop_back();
+            offsets[size] = size - 1;
+
+            algorithms::ComponentIndex index = algorithms::tarjanIterative(size, offsets.data(), successors.data());
+
+            REQUIRE(index.size() == size);
+            // Le dernier sommet de la chaîne est terminé en premier
+            REQUIRE(index.componentOf[size - 1] == 0);
+            REQUIRE(index.componentOf[0] == size - 1);
+        }
+    }
 }
\ No newline at end of file
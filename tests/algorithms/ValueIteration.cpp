@@ -0,0 +1,76 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "catch.hpp"
+
+#include "algorithms/MinMaxValues.hpp"
+#include "algorithms/ValueIteration.hpp"
+#include "generators/RandomGenerator.hpp"
+#include "MinMaxGame.hpp"
+
+using namespace algorithms;
+using namespace types;
+
+TEST_CASE("Itération sur les valeurs", "[algorithms]") {
+    std::default_random_engine generator(11);
+
+    SECTION("Comme DijkstraMinMax") {
+        for (std::size_t i = 0 ; i < 15 ; i++) {
+            ReachabilityGame game = generators::randomGenerator(50, 1, 2 + i % 4, 0, 9, true, 2, false, {0.5, 0.5}, {0.1, 0.1}, {Long::infinity, Long::infinity}, generator);
+            const CompactGame compact = CompactGame::fromReachabilityGame(game);
+            for (unsigned int p = 0 ; p < 2 ; p++) {
+                const std::vector<Long> expected = MinMaxGame::convert(game, p).getValues(game.getPlayers()[p].getGoals());
+                for (Sweep sweep : {Sweep::Jacobi, Sweep::GaussSeidel}) {
+                    std::size_t sweeps;
+                    REQUIRE(ValueIteration(compact, 1, sweep).solve(p, &sweeps) == expected);
+                    // Avec des poids positifs, V passes suffisent (plus celle qui ne change rien)
+                    REQUIRE(sweeps <= compact.size() + 1);
+                    // Petits blocs répartis sur plusieurs threads
+                    REQUIRE(ValueIteration(compact, 3, sweep, 7).solve(p) == expected);
+                }
+            }
+        }
+    }
+
+    SECTION("Gauss-Seidel ne fait pas plus de passes que Jacobi") {
+        ReachabilityGame game = generators::randomGenerator(200, 2, 6, 1, 5, false, 2, false, {0.5, 0.5}, {0.02, 0.02}, {Long::infinity, Long::infinity}, generator);
+        const CompactGame compact = CompactGame::fromReachabilityGame(game);
+        std::size_t jacobi, gaussSeidel;
+        const std::vector<Long> values = ValueIteration(compact, 1, Sweep::Jacobi).solve(0, &jacobi);
+        REQUIRE(ValueIteration(compact, 1, Sweep::GaussSeidel).solve(0, &gaussSeidel) == values);
+        REQUIRE(gaussSeidel <= jacobi);
+    }
+
+    SECTION("Poids négatifs") {
+        for (std::size_t i = 0 ; i < 15 ; i++) {
+            ReachabilityGame game = generators::randomGenerator(30, 1, 3, -2, 6, true, 2, false, {0.5, 0.5}, {0.1, 0.1}, {Long::infinity, Long::infinity}, generator);
+            const CondensedMinMax condensed(CompactGame::fromReachabilityGame(game));
+            for (unsigned int p = 0 ; p < 2 ; p++) {
+                const std::vector<Long> expected = solveMinMax(condensed, p);
+                REQUIRE(ValueIteration(condensed.getGame(), 2, Sweep::Jacobi, 4).solve(p) == expected);
+                REQUIRE(ValueIteration(condensed.getGame(), 2, Sweep::GaussSeidel, 4).solve(p) == expected);
+            }
+        }
+    }
+
+    SECTION("Blocs vides") {
+        ReachabilityGame game = generators::randomGenerator(5, 1, 2, 2, false);
+        REQUIRE_THROWS_AS(ValueIteration(CompactGame::fromReachabilityGame(game), 1, Sweep::Jacobi, 0), std::runtime_error);
+    }
+}
\ No newline at end of file
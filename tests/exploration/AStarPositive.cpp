@@ -21,6 +21,7 @@
 #include "catch.hpp"
 
 #include "exploration/BestFirstSearch.hpp"
+#include "exploration/Heuristics.hpp"
 #include "ReachabilityGame.hpp"
 #include "Vertex.hpp"
 
@@ -195,4 +196,123 @@ TEST_CASE("A* positif", "[exploration]") {
 
         REQUIRE(path == Path(game, {v4, v0, v1, v3}));
     }
-}
\ No newline at end of file
+
+    SECTION("Distances vers les cibles") {
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+        Vertex::Ptr v1 = std::make_shared<Vertex>(1, 1, 2);
+        Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 2);
+        Vertex::Ptr v3 = std::make_shared<Vertex>(3, 1, 2);
+
+        v0->addSuccessor(v1, std::vector<Long>{1, 5});
+        v0->addSuccessor(v2, std::vector<Long>{4, 4});
+        v1->addSuccessor(v2, std::vector<Long>{2, 1});
+        v2->addSuccessor(v3, std::vector<Long>{1, 1});
+        v3->addSuccessor(v3, std::vector<Long>{1, 1});
+
+        std::vector<Vertex::Ptr> vertices{v0, v1, v2, v3};
+        Graph g(vertices, 2);
+
+        Player p1(0, {v0, v2}, {v2});
+        Player p2(1, {v1, v3}, {v0, v2});
+        v2->addTargetFor(0);
+        v0->addTargetFor(1);
+        v2->addTargetFor(1);
+
+        ReachabilityGame game(g, v0, {p1, p2});
+
+        // Chaque joueur utilise ses propres poids
+        const std::vector<Long> &distances = game.getTargetDistances();
+        REQUIRE(distances == std::vector<Long>{3, 2, 0, Long::infinity, 0, 1, 0, Long::infinity});
+    }
+}
+/**
+ * \brief Une heuristique qui se dit cohérente mais ne l'est pas : AStarPositive sur les sommets pairs, rien sur les autres
+ */
+struct UnevenHeuristic {
+    static constexpr bool usesCostsMap = false;
+    static constexpr bool consistent = true;
+
+    heuristics::AStarPositive positive;
+
+    Long operator()(const Node::Ptr &node, const CostsMap &costsMap) const {
+        if (node->path.getLast()->getID() % 2 == 0) {
+            return positive(node, costsMap);
+        }
+        return heuristics::accumulatedCost(*node);
+    }
+};
+
+TEST_CASE("Table de transposition", "[exploration]") {
+    // Deux chemins de même coût et de même longueur mènent de v0 à v3
+    Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+    Vertex::Ptr v1 = std::make_shared<Vertex>(1, 1, 2);
+    Vertex::Ptr v2 = std::make_shared<Vertex>(2, 1, 2);
+    Vertex::Ptr v3 = std::make_shared<Vertex>(3, 0, 2);
+    Vertex::Ptr v4 = std::make_shared<Vertex>(4, 1, 2);
+    Vertex::Ptr v5 = std::make_shared<Vertex>(5, 0, 2);
+
+    std::vector<Vertex::Ptr> vertices{v0, v1, v2, v3, v4, v5};
+
+    v0->addSuccessor(v1, 1);
+    v0->addSuccessor(v2, 1);
+    v1->addSuccessor(v3, 1);
+    v2->addSuccessor(v3, 1);
+    v3->addSuccessor(v4, 1);
+    v3->addSuccessor(v0, 1);
+    v4->addSuccessor(v5, 2);
+    v4->addSuccessor(v3, 1);
+    v5->addSuccessor(v5, 0);
+
+    Graph g(vertices, 2);
+
+    Player p1(0, {v0, v3, v5}, {v4});
+    Player p2(1, {v1, v2, v4}, {v5});
+    v4->addTargetFor(0);
+    v5->addTargetFor(1);
+
+    ReachabilityGame game(g, v0, {p1, p2});
+
+    SearchStatistics statistics;
+    const Path path = bestFirstSearch(game, heuristics::AStarPositive(game), Long::infinity, &statistics);
+    REQUIRE(path.isANashEquilibrium());
+    REQUIRE(path.getCosts()[0] == std::make_pair(true, Long(3)));
+    REQUIRE(path.getCosts()[1] == std::make_pair(true, Long(5)));
+    REQUIRE(statistics.consistent);
+    REQUIRE(statistics.reopened == 0);
+
+    SECTION("Transpositions écartées") {
+        // Sans estimation, les deux chemins vers v3 sont développés avant d'atteindre les cibles
+        SearchStatistics zeroStatistics;
+        const Path zeroPath = bestFirstSearch(game, heuristics::Zero(), Long::infinity, &zeroStatistics);
+        REQUIRE(zeroPath.getCosts() == path.getCosts());
+        REQUIRE(zeroStatistics.consistent);
+        REQUIRE(zeroStatistics.pruned >= 1);
+    }
+
+    SECTION("Bornes infinies dans les clés") {
+        // Une borne -infini (valeur de coalition sur un cycle négatif) ne doit pas se confondre avec une borne finie
+        Node finite(2, Path(game, v0)), unbounded(2, Path(game, v0)), open(2, Path(game, v0));
+        finite.state.bounds[0] = Long(-1);
+        unbounded.state.bounds[0] = -Long::infinity;
+        open.state.bounds[0] = Long::infinity;
+        REQUIRE(transpositionKey(finite) != transpositionKey(unbounded));
+        REQUIRE(transpositionKey(finite) != transpositionKey(open));
+        REQUIRE(transpositionKey(unbounded) != transpositionKey(open));
+        REQUIRE(transpositionKey(unbounded)[3] == std::numeric_limits<long>::min());
+    }
+
+    SECTION("Heuristique non déclarée cohérente") {
+        SearchStatistics functionStatistics;
+        const Path functionPath = bestFirstSearch(game, heuristicSignature(heuristics::AStarPositive(game)), Long::infinity, &functionStatistics);
+        REQUIRE(functionPath == path);
+        REQUIRE_FALSE(functionStatistics.consistent);
+    }
+
+    SECTION("Incohérence découverte pendant l'exploration") {
+        SearchStatistics unevenStatistics;
+        const Path unevenPath = bestFirstSearch(game, UnevenHeuristic{heuristics::AStarPositive(game)}, Long::infinity, &unevenStatistics);
+        REQUIRE(unevenPath.getCosts() == path.getCosts());
+        REQUIRE_FALSE(unevenStatistics.consistent);
+        REQUIRE(unevenStatistics.reopened <= maxReopenings * unevenStatistics.expanded);
+    }
+}
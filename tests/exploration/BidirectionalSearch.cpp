@@ -0,0 +1,60 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include "exploration/BidirectionalSearch.hpp"
+#include "exploration/BestFirstSearch.hpp"
+#include "generators/RandomGenerator.hpp"
+
+using namespace std::placeholders;
+using namespace exploration;
+
+TEST_CASE("Recherche bidirectionnelle", "[exploration]") {
+    std::default_random_engine generator(17);
+    const std::vector<double> probaPlayers = {0.5, 0.5}, probaTargets = {0.05, 0.05};
+    const std::vector<types::Long> maximumTargets(2, types::Long::infinity);
+
+    std::size_t nDirect = 0;
+    for (int i = 0 ; i < 30 ; i++) {
+        ReachabilityGame game = generators::randomGenerator(40, 1, 3, 0, 6, false, 2, false, probaPlayers, probaTargets, maximumTargets, generator);
+        Path reference = bestFirstSearch(game, std::bind(&ReachabilityGame::AStartPositive, &game, _1, _2));
+
+        BidirectionalStatistics statistics;
+        Path path = bidirectionalSearch(game, types::Long::infinity, &statistics);
+        REQUIRE(path.isANashEquilibrium());
+
+        if (reference.getCosts()[0].first && reference.getCosts()[1].first) {
+            // A* a trouvé un équilibre où les deux joueurs voient leur cible : même coût total
+            REQUIRE(path.getCosts()[0].second + path.getCosts()[1].second == reference.getCosts()[0].second + reference.getCosts()[1].second);
+        }
+        if (!statistics.usedFallback) {
+            nDirect++;
+            REQUIRE(path.getCosts()[0].first);
+            REQUIRE(path.getCosts()[1].first);
+            REQUIRE(statistics.settled <= 4 * 2 * game.getGraph().size());
+        }
+        else {
+            REQUIRE(path == reference);
+            // Le relais ne reçoit que le temps qui reste : sans temps, OutOfTime
+            REQUIRE(bidirectionalSearch(game, 5) == reference);
+            REQUIRE_THROWS_AS(bidirectionalSearch(game, 0), OutOfTime);
+        }
+    }
+    REQUIRE(nDirect > 0);
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include "exploration/Engines.hpp"
+#include "exploration/BeamSearch.hpp"
+#include "exploration/BestFirstSearch.hpp"
+#include "exploration/PatternDatabase.hpp"
+#include "exploration/RandomPaths.hpp"
+#include "Vertex.hpp"
+
+using namespace std::placeholders;
+using namespace exploration;
+using namespace types;
+
+TEST_CASE("Moteurs de résolution", "[exploration]") {
+    Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+    Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 2);
+    Vertex::Ptr v2 = std::make_shared<Vertex>(2, 1, 2);
+    Vertex::Ptr v3 = std::make_shared<Vertex>(3, 0, 2);
+    Vertex::Ptr v4 = std::make_shared<Vertex>(4, 0, 2);
+
+    std::vector<Vertex::Ptr> vertices{v0, v1, v2, v3, v4};
+
+    v0->addSuccessor(v1, 1);
+    v1->addSuccessor(v0, 1);
+    v1->addSuccessor(v2, 1);
+    v2->addSuccessor(v3, 1);
+    v2->addSuccessor(v4, 4);
+    v3->addSuccessor(v0, 1);
+    v3->addSuccessor(v4, 1);
+    v4->addSuccessor(v2, 2);
+    v4->addSuccessor(v3, 1);
+
+    Graph g(vertices, 2);
+
+    Player p1(0, {v0, v1, v3, v4}, {v3});
+    Player p2(1, {v2}, {v0});
+    v3->addTargetFor(0);
+    v0->addTargetFor(1);
+
+    ReachabilityGame game(g, v1, {p1, p2});
+    EngineOptions options;
+
+    SECTION("Les moteurs exacts trouvent le même coût que A*") {
+        Path reference = bestFirstSearch(game, std::bind(&ReachabilityGame::AStartPositive, &game, _1, _2));
+        REQUIRE(findEngine("astar")(game, options) == reference);
+
+        Path uniform = findEngine("uniform")(game, options);
+        REQUIRE(uniform.isANashEquilibrium());
+        REQUIRE(uniform.getCosts()[0].second + uniform.getCosts()[1].second == reference.getCosts()[0].second + reference.getCosts()[1].second);
+    }
+
+    SECTION("Chemins aléatoires") {
+        options.nPaths = 100;
+        Path path = findEngine("random")(game, options);
+        REQUIRE(path.isANashEquilibrium());
+    }
+
+    SECTION("Chemins aléatoires en parallèle") {
+        Path reference = bestFirstSearch(game, std::bind(&ReachabilityGame::AStartPositive, &game, _1, _2));
+        Path path = parallelRandomPath(game, 2000, Long::infinity, 3, 42);
+        REQUIRE(path.isANashEquilibrium());
+        REQUIRE(path.getCosts()[0].first);
+        REQUIRE(path.getCosts()[1].first);
+        REQUIRE(path.getCosts()[0].second + path.getCosts()[1].second == reference.getCosts()[0].second + reference.getCosts()[1].second);
+
+        // Avec un seul thread, la même graine donne le même chemin
+        REQUIRE(parallelRandomPath(game, 50, Long::infinity, 1, 7) == parallelRandomPath(game, 50, Long::infinity, 1, 7));
+    }
+
+    SECTION("Chemins aléatoires guidés") {
+        Path path = guidedRandomPath(game, 200, Long::infinity, 2, 3);
+        REQUIRE(path.isANashEquilibrium());
+        REQUIRE(path.getCosts()[0].first);
+        REQUIRE(path.getCosts()[1].first);
+    }
+
+    SECTION("Recherche en faisceau") {
+        auto heuristic = std::bind(&ReachabilityGame::AStartPositive, &game, _1, _2);
+        Path reference = bestFirstSearch(game, heuristic);
+
+        // Un faisceau assez large ne perd rien : même coût que A*
+        Path wide = beamSearch(game, heuristic, 1000);
+        REQUIRE(wide.isANashEquilibrium());
+        REQUIRE(wide.getCosts()[0].second + wide.getCosts()[1].second == reference.getCosts()[0].second + reference.getCosts()[1].second);
+
+        // Le nombre de threads ne change pas le résultat
+        REQUIRE(beamSearch(game, heuristic, 2, Long::infinity, 1) == beamSearch(game, heuristic, 2, Long::infinity, 3));
+
+        options.beamWidth = 1;
+        try {
+            REQUIRE(findEngine("beam")(game, options).isANashEquilibrium());
+        }
+        catch (const EmptyFrontier&) {
+            // Un faisceau de largeur 1 peut perdre tous ses noeuds
+        }
+    }
+
+    SECTION("Moteur inconnu") {
+        REQUIRE(engines().size() >= 5);
+        REQUIRE_THROWS_AS(findEngine("inconnu"), std::runtime_error);
+    }
+}
+TEST_CASE("Moteurs de résolution avec un cycle négatif", "[exploration]") {
+    // Le cycle 0 -> 1 -> 0 est de poids -1 : les Dijkstra vers les cibles ne terminaient pas
+    Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 1);
+    Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 1);
+    Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 1);
+    v0->addSuccessor(v1, 1);
+    v1->addSuccessor(v0, -2);
+    v1->addSuccessor(v2, 1);
+    v2->addSuccessor(v2, 0);
+    v2->addTargetFor(0);
+    Graph g({v0, v1, v2}, 1);
+    Player p1(0, {v0, v1, v2}, {v2});
+    ReachabilityGame game(g, v0, {p1});
+
+    const std::vector<Long> &distances = game.getTargetDistances();
+    REQUIRE(distances[0] == -Long::infinity);
+    REQUIRE(distances[1] == -Long::infinity);
+    REQUIRE(distances[2] == 0);
+    REQUIRE_THROWS_AS(PatternDatabase(game), std::runtime_error);
+
+    EngineOptions options;
+    options.allowedTime = 2;
+    options.nPaths = 100;
+    for (const std::string engine : {"astar", "patterns", "uniform", "guided", "random"}) {
+        try {
+            findEngine(engine)(game, options);
+        }
+        catch (const std::exception&) {
+            // Aucun équilibre n'est trouvé : l'important est que la résolution termine
+        }
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "catch.hpp"
+
+#include "exploration/BestFirstSearch.hpp"
+#include "exploration/Engines.hpp"
+#include "exploration/ForcedChains.hpp"
+#include "exploration/Heuristics.hpp"
+
+using namespace exploration;
+using namespace types;
+
+TEST_CASE("Chaînes de coups forcés", "[exploration]") {
+    SECTION("Contraction") {
+        // v1 et v2 n'ont qu'un successeur et ne sont pas des cibles
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+        Vertex::Ptr v1 = std::make_shared<Vertex>(1, 1, 2);
+        Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 2);
+        Vertex::Ptr v3 = std::make_shared<Vertex>(3, 1, 2);
+        Vertex::Ptr v4 = std::make_shared<Vertex>(4, 1, 2);
+        Vertex::Ptr v5 = std::make_shared<Vertex>(5, 0, 2);
+
+        v0->addSuccessor(v1, std::vector<Long>{1, 2});
+        v0->addSuccessor(v4, 3);
+        v1->addSuccessor(v2, std::vector<Long>{1, 0});
+        v2->addSuccessor(v3, 1);
+        v3->addSuccessor(v5, 1);
+        v3->addSuccessor(v0, 1);
+        v4->addSuccessor(v5, 5);
+        v4->addSuccessor(v3, 1);
+        v5->addSuccessor(v5, 0);
+
+        Graph g({v0, v1, v2, v3, v4, v5}, 2);
+        Player p1(0, {v0, v2, v5}, {v3});
+        Player p2(1, {v1, v3, v4}, {v5});
+        v3->addTargetFor(0);
+        v5->addTargetFor(1);
+        ReachabilityGame game(g, v0, {p1, p2});
+
+        const ForcedChains chains(game);
+        REQUIRE_FALSE(chains.empty());
+        REQUIRE(chains.getNumberRemoved() == 2);
+
+        const ReachabilityGame &contracted = chains.getGame();
+        REQUIRE(contracted.getGraph().size() == 4);
+        REQUIRE(contracted.getMaxLength() < game.getMaxLength());
+        // v0 -> v1 -> v2 -> v3 devient un seul arc (v3 est le sommet 1 du jeu contracté)
+        REQUIRE(contracted.getInit()->getWeights(1) == std::vector<Long>{3, 3});
+        for (unsigned int v = 0 ; v < 4 ; v++) {
+            REQUIRE(contracted.getCoalitionValues(0)[v] == game.getCoalitionValues(0)[chains.expand(Path(contracted, contracted.getGraph().getVertices()[v])).getLast()->getID()]);
+        }
+
+        const Path reference = bestFirstSearch(game, heuristics::AStarPositive(game));
+        const Path path = chains.expand(bestFirstSearch(contracted, heuristics::AStarPositive(contracted)));
+        REQUIRE(path == reference);
+        REQUIRE(path.getSteps().size() == 5);
+        REQUIRE(path.isANashEquilibrium());
+
+        EngineOptions options;
+        REQUIRE(findEngine("astar")(game, options) == reference);
+        REQUIRE(findEngine("uniform")(game, options).getCosts() == reference.getCosts());
+
+        // La contraction est gardée par le jeu d'une résolution à l'autre
+        const ForcedChains &cached = game.getForcedChains();
+        REQUIRE(&game.getForcedChains() == &cached);
+        REQUIRE(cached.getNumberRemoved() == 2);
+        std::size_t nCalls = 0;
+        REQUIRE(searchContracted(game, 5, [&](const ReachabilityGame &searched, Long allowedTime) {
+            nCalls++;
+            REQUIRE(&searched == &cached.getGame());
+            REQUIRE(allowedTime == 5);
+            return bestFirstSearch(searched, heuristics::AStarPositive(searched), allowedTime);
+        }) == reference);
+        REQUIRE(nCalls == 1);
+    }
+
+    SECTION("Cycle de sommets forcés") {
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 1);
+        Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 1);
+        Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 1);
+        Vertex::Ptr v3 = std::make_shared<Vertex>(3, 0, 1);
+        v0->addSuccessor(v1, 1);
+        v0->addSuccessor(v3, 5);
+        v1->addSuccessor(v2, 1);
+        v2->addSuccessor(v1, 1);
+        v3->addSuccessor(v3, 0);
+        Graph g({v0, v1, v2, v3}, 1);
+        Player p(0, {v0, v1, v2, v3}, {v3});
+        v3->addTargetFor(0);
+        ReachabilityGame game(g, v0, {p});
+
+        const ForcedChains chains(game);
+        REQUIRE(chains.getNumberRemoved() == 1);
+        REQUIRE(chains.getGame().getGraph().size() == 3);
+    }
+
+    SECTION("Deux chaînes vers le même sommet") {
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 1);
+        Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 1);
+        Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 1);
+        Vertex::Ptr v3 = std::make_shared<Vertex>(3, 0, 1);
+        v0->addSuccessor(v1, 1);
+        v0->addSuccessor(v2, 2);
+        v1->addSuccessor(v3, 1);
+        v2->addSuccessor(v3, 1);
+        v3->addSuccessor(v3, 0);
+        Graph g({v0, v1, v2, v3}, 1);
+        Player p(0, {v0, v1, v2, v3}, {v3});
+        v3->addTargetFor(0);
+        ReachabilityGame game(g, v0, {p});
+
+        const ForcedChains chains(game);
+        REQUIRE(chains.getNumberRemoved() == 1);
+        const Path path = chains.expand(bestFirstSearch(chains.getGame(), heuristics::Zero()));
+        REQUIRE(path.getSteps().size() == 3);
+        REQUIRE(path.getCosts()[0] == std::make_pair(true, Long(2)));
+    }
+
+    SECTION("Rien à contracter") {
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 1);
+        v0->addSuccessor(v0, 1);
+        v0->addTargetFor(0);
+        Graph g({v0}, 1);
+        Player p(0, {v0}, {v0});
+        ReachabilityGame game(g, v0, {p});
+
+        const ForcedChains chains(game);
+        REQUIRE(chains.empty());
+        REQUIRE(&chains.getGame() == &game);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "catch.hpp"
+
+#include "exploration/Frontier.hpp"
+#include "ReachabilityGame.hpp"
+
+using namespace exploration;
+using namespace types;
+
+TEST_CASE("Frontière", "[exploration]") {
+    Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+    Vertex::Ptr v1 = std::make_shared<Vertex>(1, 1, 2);
+    v0->addSuccessor(v1, 1);
+    v1->addSuccessor(v0, 1);
+    v1->addSuccessor(v1, 1);
+    Graph g({v0, v1}, 2);
+    Player p1(0, {v0}, {v0});
+    Player p2(1, {v1}, {v1});
+    ReachabilityGame game(g, v0, {p1, p2});
+
+    // Un noeud de coût f dont le chemin a la longueur donnée et où reached joueurs ont vu une cible
+    auto makeNode = [&](Long f, std::size_t length, std::size_t reached) {
+        Path path(game, v0);
+        for (std::size_t i = 1 ; i < length ; i++) {
+            path.addStep(i % 2 ? v1 : v0);
+        }
+        Node::Ptr node = std::make_shared<Node>(2, path);
+        for (unsigned int p = 0 ; p < reached ; p++) {
+            node->state.notVisitedPlayers.erase(p);
+        }
+        node->pathCost = f;
+        return node;
+    };
+
+    SECTION("Par coût puis par profondeur") {
+        Frontier frontier;
+        Node::Ptr shallow = makeNode(5, 1, 0), deep = makeNode(5, 3, 0), sibling = makeNode(5, 3, 0), cheap = makeNode(4, 1, 0);
+        for (const Node::Ptr &node : {shallow, deep, sibling, cheap}) {
+            frontier.push(node);
+        }
+        REQUIRE(frontier.size() == 4);
+        REQUIRE(frontier.pop() == cheap);
+        REQUIRE(frontier.pop() == deep);
+        REQUIRE(frontier.pop() == sibling);
+        REQUIRE(frontier.pop() == shallow);
+        REQUIRE(frontier.empty());
+    }
+
+    SECTION("Plus de joueurs satisfaits d'abord") {
+        Frontier frontier(TieBreaking::MostReached);
+        Node::Ptr deep = makeNode(5, 4, 0), reached = makeNode(5, 1, 1);
+        frontier.push(deep);
+        frontier.push(reached);
+        REQUIRE(frontier.pop() == reached);
+        REQUIRE(frontier.pop() == deep);
+    }
+
+    SECTION("Plus petite estimation d'abord") {
+        Frontier frontier(TieBreaking::LowestHeuristic);
+        // a a déjà payé 4 : h vaut 1, contre 5 pour b
+        Node::Ptr a = makeNode(5, 2, 0), b = makeNode(5, 1, 0);
+        a->state.epsilon = {2, 2};
+        frontier.push(b);
+        frontier.push(a);
+        REQUIRE(frontier.pop() == a);
+        REQUIRE(frontier.pop() == b);
+    }
+
+    REQUIRE(parseTieBreaking("reached") == TieBreaking::MostReached);
+    REQUIRE_THROWS_AS(parseTieBreaking("largeur"), std::runtime_error);
+}
\ No newline at end of file
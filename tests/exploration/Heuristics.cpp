@@ -0,0 +1,110 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "catch.hpp"
+
+#include "exploration/BestFirstSearch.hpp"
+#include "exploration/Heuristics.hpp"
+#include "ReachabilityGame.hpp"
+#include "Vertex.hpp"
+
+using namespace std::placeholders;
+using namespace exploration;
+using namespace types;
+
+static_assert(!HeuristicTraits<heuristics::Zero>::usesCostsMap, "Zero ne lit pas les coûts");
+static_assert(!HeuristicTraits<heuristics::AStarPositive>::usesCostsMap, "AStarPositive ne lit pas les coûts");
+static_assert(HeuristicTraits<heuristicSignature>::usesCostsMap, "Une std::function peut lire les coûts");
+
+/**
+ * \brief Somme des coûts des joueurs qui voient une cible
+ */
+Long reachedCost(const Path &path) {
+    Long total = 0;
+    for (const auto &cost : path.getCosts()) {
+        if (cost.first) {
+            total += cost.second;
+        }
+    }
+    return total;
+}
+
+TEST_CASE("Heuristiques", "[exploration]") {
+    // Même jeu que "Petit exemple" dans AStarPositive.cpp
+    Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+    Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 2);
+    Vertex::Ptr v2 = std::make_shared<Vertex>(2, 1, 2);
+    Vertex::Ptr v3 = std::make_shared<Vertex>(3, 0, 2);
+    Vertex::Ptr v4 = std::make_shared<Vertex>(4, 0, 2);
+
+    std::vector<Vertex::Ptr> vertices{v0, v1, v2, v3, v4};
+
+    v0->addSuccessor(v1, 1);
+    v1->addSuccessor(v0, 1);
+    v1->addSuccessor(v2, 1);
+    v2->addSuccessor(v3, 1);
+    v2->addSuccessor(v4, 4);
+    v3->addSuccessor(v0, 1);
+    v3->addSuccessor(v4, 1);
+    v4->addSuccessor(v2, 2);
+    v4->addSuccessor(v3, 1);
+
+    Graph g(vertices, 2);
+
+    Player p1(0, {v0, v1, v3, v4}, {v3});
+    Player p2(1, {v2}, {v0});
+    v3->addTargetFor(0);
+    v0->addTargetFor(1);
+
+    ReachabilityGame game(g, v1, {p1, p2});
+    const Path expected(game, {v1, v2, v3, v0});
+
+    SECTION("Valeurs") {
+        Node::Ptr node = std::make_shared<Node>(2, Path(game, {v1, v2}));
+        node->state.epsilon = {1, 1};
+        const CostsMap empty;
+
+        REQUIRE(heuristics::accumulatedCost(*node) == 2);
+        REQUIRE(heuristics::Zero()(node, empty) == 2);
+        // Depuis v2 : 1 pour le joueur 0 (vers v3), 2 pour le joueur 1 (vers v0 par v3)
+        REQUIRE(heuristics::AStarPositive(game)(node, empty) == 2 + 1 + 2);
+        REQUIRE(game.AStartPositive(node, empty) == 2 + 1 + 2);
+        REQUIRE(heuristics::MaxOverPlayers(game)(node, empty) == 2 + 2);
+
+        node->state.notVisitedPlayers.erase(0);
+        node->state.RP = 1;
+        REQUIRE(heuristics::AStarPositive(game)(node, empty) == 2 + 2);
+        REQUIRE(heuristics::MaxOverPlayers(game)(node, empty) == 2 + 2);
+    }
+
+    SECTION("Patron et adaptateur") {
+        heuristicSignature function = std::bind(&ReachabilityGame::AStartPositive, &game, _1, _2);
+        REQUIRE(bestFirstSearch(game, function) == expected);
+        REQUIRE(bestFirstSearch(game, std::bind(&ReachabilityGame::AStartPositive, &game, _1, _2)) == expected);
+        REQUIRE(bestFirstSearch(game, heuristics::AStarPositive(game)) == expected);
+    }
+
+    SECTION("Heuristiques admissibles") {
+        const Long best = reachedCost(expected);
+        for (const Path &path : {bestFirstSearch(game, heuristics::Zero()), bestFirstSearch(game, heuristics::MaxOverPlayers(game))}) {
+            REQUIRE(path.isANashEquilibrium());
+            REQUIRE(reachedCost(path) == best);
+        }
+    }
+}
\ No newline at end of file
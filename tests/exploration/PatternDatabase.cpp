@@ -0,0 +1,138 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <cstdio>
+
+#include "catch.hpp"
+
+#include "exploration/BestFirstSearch.hpp"
+#include "exploration/Heuristics.hpp"
+#include "exploration/PatternDatabase.hpp"
+#include "generators/RandomGenerator.hpp"
+
+using namespace exploration;
+using namespace types;
+
+TEST_CASE("Base de motifs", "[exploration]") {
+    // Même jeu que "Petit exemple" dans AStarPositive.cpp
+    Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+    Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 2);
+    Vertex::Ptr v2 = std::make_shared<Vertex>(2, 1, 2);
+    Vertex::Ptr v3 = std::make_shared<Vertex>(3, 0, 2);
+    Vertex::Ptr v4 = std::make_shared<Vertex>(4, 0, 2);
+
+    std::vector<Vertex::Ptr> vertices{v0, v1, v2, v3, v4};
+
+    v0->addSuccessor(v1, 1);
+    v1->addSuccessor(v0, 1);
+    v1->addSuccessor(v2, 1);
+    v2->addSuccessor(v3, 1);
+    v2->addSuccessor(v4, 4);
+    v3->addSuccessor(v0, 1);
+    v3->addSuccessor(v4, 1);
+    v4->addSuccessor(v2, 2);
+    v4->addSuccessor(v3, 1);
+
+    Graph g(vertices, 2);
+
+    Player p1(0, {v0, v1, v3, v4}, {v3});
+    Player p2(1, {v2}, {v0});
+    v3->addTargetFor(0);
+    v0->addTargetFor(1);
+
+    ReachabilityGame game(g, v1, {p1, p2});
+    const PatternDatabase database(game);
+
+    SECTION("Coûts joints") {
+        // Depuis v1, les cibles sont dans des directions opposées : 5 au lieu de 2 + 1
+        const std::vector<Long> expected{3, 5, 3, 1, 3};
+        for (unsigned int v = 0 ; v < 5 ; v++) {
+            REQUIRE(database.getJointCost(0, 1, v) == expected[v]);
+            REQUIRE(database.getJointCost(1, 0, v) == expected[v]);
+        }
+
+        Node::Ptr init = std::make_shared<Node>(2, Path(game, v1));
+        REQUIRE(heuristics::AStarPositive(game)(init, CostsMap()) == 3);
+        REQUIRE(heuristics::PairPatterns(game, database)(init, CostsMap()) == 5);
+    }
+
+    SECTION("Exploration") {
+        REQUIRE(bestFirstSearch(game, heuristics::PairPatterns(game, database)) == Path(game, {v1, v2, v3, v0}));
+    }
+
+    SECTION("Fichier") {
+        const std::string path = "patternDatabaseTest.pdb";
+        std::remove(path.c_str());
+
+        const PatternDatabase built = PatternDatabase::loadOrBuild(game, path);
+        const PatternDatabase loaded = PatternDatabase::load(game, path);
+        for (unsigned int v = 0 ; v < 5 ; v++) {
+            REQUIRE(loaded.getJointCost(0, 1, v) == database.getJointCost(0, 1, v));
+            REQUIRE(built.getJointCost(0, 1, v) == database.getJointCost(0, 1, v));
+        }
+
+        // Une base calculée pour un autre jeu est refusée, puis remplacée par loadOrBuild
+        std::default_random_engine generator(3);
+        ReachabilityGame other = generators::randomGenerator(5, 1, 2, 1, 3, false, 2, false, {0.5, 0.5}, {0.3, 0.3}, std::vector<Long>(2, Long::infinity), generator);
+        REQUIRE_THROWS_AS(PatternDatabase::load(other, path), std::runtime_error);
+        PatternDatabase::loadOrBuild(other, path);
+        REQUIRE_NOTHROW(PatternDatabase::load(other, path));
+
+        std::remove(path.c_str());
+    }
+}
+
+TEST_CASE("Base de motifs sur des jeux aléatoires", "[exploration]") {
+    std::default_random_engine generator(5);
+    const std::vector<double> probaPlayers = {0.34, 0.33, 0.33}, probaTargets = {0.05, 0.05, 0.05};
+    const std::vector<Long> maximumTargets(3, Long::infinity);
+
+    for (int i = 0 ; i < 15 ; i++) {
+        ReachabilityGame game = generators::randomGenerator(20, 1, 3, 1, 6, false, 3, false, probaPlayers, probaTargets, maximumTargets, generator);
+        const PatternDatabase database(game);
+
+        // Le coût joint n'est jamais plus petit que la somme des distances indépendantes
+        const std::vector<Long> &distances = game.getTargetDistances();
+        const std::size_t size = game.getGraph().size();
+        for (unsigned int v = 0 ; v < size ; v++) {
+            REQUIRE(database.getJointCost(0, 2, v) >= distances[v] + distances[2 * size + v]);
+        }
+
+        // Les deux heuristiques sont admissibles : même coût pour le meilleur équilibre
+        const Path reference = bestFirstSearch(game, heuristics::AStarPositive(game));
+        const Path path = bestFirstSearch(game, heuristics::PairPatterns(game, database));
+        REQUIRE(path.isANashEquilibrium());
+        REQUIRE(path.getCosts().size() == reference.getCosts().size());
+        Long costReference = 0, cost = 0;
+        std::size_t reachedReference = 0, reached = 0;
+        for (std::size_t p = 0 ; p < path.getCosts().size() ; p++) {
+            if (reference.getCosts()[p].first) {
+                reachedReference++;
+                costReference += reference.getCosts()[p].second;
+            }
+            if (path.getCosts()[p].first) {
+                reached++;
+                cost += path.getCosts()[p].second;
+            }
+        }
+        if (reached == 3 && reachedReference == 3) {
+            REQUIRE(cost == costReference);
+        }
+    }
+}
\ No newline at end of file
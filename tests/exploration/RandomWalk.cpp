@@ -0,0 +1,140 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include "exploration/RandomWalk.hpp"
+#include "generators/RandomGenerator.hpp"
+
+using namespace exploration;
+
+TEST_CASE("Marches aléatoires", "[exploration]") {
+    std::default_random_engine generator(13);
+    const std::vector<double> probaPlayers = {0.25, 0.25, 0.5}, probaTargets = {0.1, 0.1, 0.1};
+    const std::vector<types::Long> maximumTargets(3, types::Long::infinity);
+    ReachabilityGame game = generators::randomGenerator(30, 1, 3, 1, 5, true, 3, false, probaPlayers, probaTargets, maximumTargets, generator);
+    const CompactGame compact = CompactGame::fromReachabilityGame(game);
+    RandomWalk walk(game, compact);
+
+    // La marche doit donner les mêmes coûts et le même verdict que Path
+    for (int i = 0 ; i < 200 ; i++) {
+        walk.walk(game.getMaxLength(), generator);
+        REQUIRE(walk.size() == game.getMaxLength() + 1);
+
+        const Path path = walk.toPath(walk.getVertices());
+        REQUIRE(path.size() == walk.size());
+        std::size_t nReached = 0;
+        for (unsigned int p = 0 ; p < 3 ; p++) {
+            REQUIRE(path.getCosts()[p].first == walk.hasReached(p));
+            REQUIRE(path.getCosts()[p].second == walk.getCosts()[p]);
+            nReached += walk.hasReached(p);
+        }
+        REQUIRE(nReached == walk.getNumberReached());
+        REQUIRE(path.isANashEquilibrium() == walk.isANashEquilibrium());
+    }
+
+    // La vérification au fur et à mesure donne le même verdict que la vérification sur la marche complète
+    std::size_t nEquilibria = 0;
+    for (int i = 0 ; i < 500 ; i++) {
+        std::default_random_engine copy = generator;
+        walk.walk(game.getMaxLength(), generator);
+        const bool nash = walk.isANashEquilibrium();
+        const std::vector<long> costs = walk.getCosts();
+
+        REQUIRE(walk.walkEquilibrium(game.getMaxLength(), copy) == nash);
+        if (nash) {
+            nEquilibria++;
+            REQUIRE(walk.getCosts() == costs);
+            REQUIRE(walk.toPath(walk.getVertices()).isANashEquilibrium());
+        }
+    }
+    REQUIRE(nEquilibria > 0);
+
+    // Les marches guidées passent le même test
+    GuidedSampler sampler(game, compact, 0.5);
+    std::size_t nGuided = 0;
+    for (int i = 0 ; i < 500 ; i++) {
+        const bool nash = walk.walkEquilibrium(game.getMaxLength(), sampler, generator);
+        if (nash) {
+            nGuided++;
+        }
+        if (nash || walk.size() == game.getMaxLength() + 1) {
+            // La marche n'a pas été abandonnée : Path doit donner le même verdict
+            REQUIRE(walk.toPath(walk.getVertices()).isANashEquilibrium() == nash);
+        }
+    }
+    REQUIRE(nGuided >= nEquilibria);
+}
+TEST_CASE("Marches aléatoires bloquées", "[exploration]") {
+    // Le sommet 1 n'a aucun successeur
+    Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+    Vertex::Ptr v1 = std::make_shared<Vertex>(1, 1, 2);
+    v0->addSuccessor(v0, {1, 1});
+    v0->addSuccessor(v1, {1, 1});
+    v1->addTargetFor(0);
+    Graph g({v0, v1}, 2);
+    Player p1(0, {v0}, {v1});
+    Player p2(1, {v1}, {});
+    ReachabilityGame game(g, v0, {p1, p2});
+    const CompactGame compact = CompactGame::fromReachabilityGame(game);
+    RandomWalk walk(game, compact);
+    GuidedSampler sampler(game, compact);
+
+    std::default_random_engine generator(5);
+    REQUIRE(sampler.choose(1, 0, generator) == compact.endEdges(1));
+    for (int i = 0 ; i < 50 ; i++) {
+        walk.walk(100, generator);
+        REQUIRE(walk.size() <= 101);
+        if (walk.getVertices().back() == 1) {
+            REQUIRE(walk.size() < 101);
+        }
+
+        walk.walkEquilibrium(100, generator);
+        REQUIRE(walk.size() <= 101);
+        walk.walkEquilibrium(100, sampler, generator);
+        REQUIRE(walk.size() <= 101);
+    }
+}
+
+TEST_CASE("Marches aléatoires avec un cycle négatif", "[exploration]") {
+    // Le joueur peut tourner indéfiniment dans le cycle 0 -> 1 -> 0 de poids -1 : sa valeur de coalition est -infini
+    Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 1);
+    Vertex::Ptr v1 = std::make_shared<Vertex>(1, 0, 1);
+    Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 1);
+    v0->addSuccessor(v1, -2);
+    v1->addSuccessor(v0, 1);
+    v1->addSuccessor(v2, 1);
+    v2->addSuccessor(v2, 1);
+    v2->addTargetFor(0);
+    Graph g({v0, v1, v2}, 1);
+    Player p1(0, {v0, v1, v2}, {v2});
+    ReachabilityGame game(g, v0, {p1});
+    const CompactGame compact = CompactGame::fromReachabilityGame(game);
+    REQUIRE(game.getCoalitionValues(0)[0] == -types::Long::infinity);
+
+    RandomWalk walk(game, compact);
+    std::default_random_engine generator(3);
+    for (int i = 0 ; i < 50 ; i++) {
+        REQUIRE_FALSE(walk.walkEquilibrium(10, generator));
+        REQUIRE(walk.size() == 1);
+
+        walk.walk(10, generator);
+        REQUIRE_FALSE(walk.isANashEquilibrium());
+        REQUIRE_FALSE(walk.toPath(walk.getVertices()).isANashEquilibrium());
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include <sstream>
+
+#include "generators/BatchGenerator.hpp"
+#include "generators/RandomTreeLikeGenerator.hpp"
+
+using namespace generators;
+
+std::string describe(const ReachabilityGame &game) {
+    std::ostringstream stream;
+    stream << game;
+    return stream.str();
+}
+
+TEST_CASE("Génération de jeux en parallèle", "[generators]") {
+    gameGeneratorSignature generate = [](std::default_random_engine &generator) {
+        return randomTreeLikeGenerator(30, 1, 3, 0.1, 0.1, 0.1, 0.1, 1, 5, true, 3, true, {0.2, 0.3, 0.5}, {0.1, 0.1, 0.1}, {types::Long::infinity, types::Long::infinity, types::Long::infinity}, generator);
+    };
+
+    std::vector<ReachabilityGame> sequential = batchGenerator(20, 42, generate, 1);
+    std::vector<ReachabilityGame> parallel = batchGenerator(20, 42, generate, 4);
+
+    REQUIRE(sequential.size() == 20);
+    REQUIRE(parallel.size() == 20);
+
+    SECTION("Le jeu i ne dépend pas du nombre de threads") {
+        for (std::size_t i = 0 ; i < sequential.size() ; i++) {
+            REQUIRE(describe(sequential[i]) == describe(parallel[i]));
+        }
+    }
+
+    SECTION("Le jeu i peut être régénéré seul") {
+        std::default_random_engine generator = streamEngine(42, 7);
+        REQUIRE(describe(generate(generator)) == describe(parallel[7]));
+    }
+
+    SECTION("Les flux sont différents") {
+        REQUIRE(streamSeed(42, 0) != streamSeed(42, 1));
+        REQUIRE(streamSeed(42, 0) != streamSeed(43, 0));
+        REQUIRE(describe(parallel[0]) != describe(parallel[1]));
+    }
+}
\ No newline at end of file
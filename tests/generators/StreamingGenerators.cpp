@@ -0,0 +1,165 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include "CompactGame.hpp"
+#include "generators/StreamingGenerators.hpp"
+#include "algorithms/Tarjan.hpp"
+
+using namespace generators;
+
+TEST_CASE("Jeu compact", "[generators]") {
+    CompactGameBuilder builder;
+    builder.begin(3, 2, 1);
+    builder.setPlayer(1, 1);
+    builder.addTarget(2, 0);
+    builder.addTarget(0, 1);
+
+    // Les arcs arrivent dans le désordre
+    const long w12[] = {1, 2}, w01[] = {3, 4}, w10[] = {5, 6}, w00[] = {7, 8};
+    builder.addEdge(1, 2, w12);
+    builder.addEdge(0, 1, w01);
+    builder.addEdge(1, 0, w10);
+    builder.addEdge(0, 0, w00);
+    builder.finish();
+
+    const CompactGame game = builder.getGame();
+    REQUIRE(game.size() == 3);
+    REQUIRE(game.getNumberEdges() == 4);
+    REQUIRE(game.getInit() == 1);
+    REQUIRE(game.getPlayer(0) == 0);
+    REQUIRE(game.getPlayer(1) == 1);
+    REQUIRE(game.isTargetFor(2, 0));
+    REQUIRE_FALSE(game.isTargetFor(2, 1));
+    REQUIRE(game.isTargetFor(0, 1));
+    REQUIRE_FALSE(game.isTarget(1));
+
+    // Les arcs sont regroupés par sommet de départ, dans l'ordre d'arrivée
+    REQUIRE(game.getNumberSuccessors(0) == 2);
+    REQUIRE(game.getNumberSuccessors(1) == 2);
+    REQUIRE(game.getNumberSuccessors(2) == 0);
+    REQUIRE(game.getSuccessor(game.beginEdges(0)) == 1);
+    REQUIRE(game.getWeights(game.beginEdges(0))[1] == 4);
+    REQUIRE(game.getSuccessor(game.beginEdges(0) + 1) == 0);
+    REQUIRE(game.getSuccessor(game.beginEdges(1)) == 2);
+    REQUIRE(game.getWeights(game.beginEdges(1) + 1)[0] == 5);
+
+    SECTION("Conversion en ReachabilityGame et retour") {
+        ReachabilityGame reachability = game.toReachabilityGame();
+        REQUIRE(reachability.getInit()->getID() == 1);
+        REQUIRE(reachability.getGraph().getVertices()[1]->getPlayer() == 1);
+        REQUIRE(reachability.getGraph().getWeights(1, 0)[1] == 6);
+        REQUIRE(reachability.getPlayers()[0].getGoals().size() == 1);
+
+        const CompactGame back = CompactGame::fromReachabilityGame(reachability);
+        REQUIRE(back.size() == 3);
+        REQUIRE(back.getNumberEdges() == 4);
+        REQUIRE(back.getInit() == 1);
+        REQUIRE(back.isTargetFor(0, 1));
+        REQUIRE(back.isTargetFor(2, 0));
+        REQUIRE(back.getNumberSuccessors(0) == 2);
+    }
+}
+
+TEST_CASE("Générateurs en flux", "[generators]") {
+    const std::size_t nPlayers = 2;
+    const std::vector<double> probaPlayers = {0.5, 0.5}, probaTargets = {0.1, 0.1};
+    const std::vector<types::Long> maximumTargets = {types::Long::infinity, types::Long::infinity};
+
+    SECTION("Générateur naïf") {
+        std::default_random_engine generator(5);
+        CompactGameBuilder builder;
+        streamRandomGenerator(builder, 1000, 2, 4, 1, 5, true, nPlayers, false, probaPlayers, probaTargets, maximumTargets, generator);
+        const CompactGame game = builder.getGame();
+
+        REQUIRE(game.size() == 1000);
+        for (unsigned int v = 0 ; v < game.size() ; v++) {
+            REQUIRE(game.getNumberSuccessors(v) >= 2);
+            REQUIRE(game.getNumberSuccessors(v) <= 4);
+            for (std::size_t e = game.beginEdges(v) ; e < game.endEdges(v) ; e++) {
+                REQUIRE(game.getWeights(e)[0] >= 1);
+                REQUIRE(game.getWeights(e)[1] <= 5);
+            }
+            // Sans cibles partagées, un sommet est une cible pour au plus un joueur
+            REQUIRE_FALSE((game.isTargetFor(v, 0) && game.isTargetFor(v, 1)));
+        }
+
+        // Le même générateur donne le même jeu
+        std::default_random_engine again(5);
+        CompactGameBuilder otherBuilder;
+        streamRandomGenerator(otherBuilder, 1000, 2, 4, 1, 5, true, nPlayers, false, probaPlayers, probaTargets, maximumTargets, again);
+        const CompactGame other = otherBuilder.getGame();
+        REQUIRE(other.getNumberEdges() == game.getNumberEdges());
+        REQUIRE(std::equal(game.getSuccessors(), game.getSuccessors() + game.getNumberEdges(), other.getSuccessors()));
+    }
+
+    SECTION("Générateur arbre") {
+        std::default_random_engine generator(8);
+        CompactGameBuilder builder;
+        streamRandomTreeLikeGenerator(builder, 2000, 1, 3, 0.01, 0.001, 0.001, 0.001, 1, 1, false, nPlayers, true, probaPlayers, probaTargets, maximumTargets, generator);
+        const CompactGame game = builder.getGame();
+
+        REQUIRE(game.size() == 2000);
+        // Chaque sommet (sauf la racine) a un parent d'ID inférieur et aucun sommet n'est un cul-de-sac
+        std::vector<bool> hasParent(game.size(), false);
+        for (unsigned int v = 0 ; v < game.size() ; v++) {
+            REQUIRE(game.getNumberSuccessors(v) >= 1);
+            for (std::size_t e = game.beginEdges(v) ; e < game.endEdges(v) ; e++) {
+                if (game.getSuccessor(e) > v) {
+                    hasParent[game.getSuccessor(e)] = true;
+                }
+            }
+        }
+        for (unsigned int v = 1 ; v < game.size() ; v++) {
+            REQUIRE(hasParent[v]);
+        }
+        // Tous les sommets sont accessibles depuis la racine
+        std::vector<bool> reached(game.size(), false);
+        std::vector<unsigned int> stack = {0};
+        reached[0] = true;
+        while (!stack.empty()) {
+            unsigned int v = stack.back();
+            stack.pop_back();
+            for (std::size_t e = game.beginEdges(v) ; e < game.endEdges(v) ; e++) {
+                if (!reached[game.getSuccessor(e)]) {
+                    reached[game.getSuccessor(e)] = true;
+                    stack.push_back(game.getSuccessor(e));
+                }
+            }
+        }
+        REQUIRE(std::count(reached.begin(), reached.end(), true) == long(game.size()));
+    }
+
+    SECTION("Générateur fortement connexe") {
+        std::default_random_engine generator(13);
+        CompactGameBuilder builder;
+        streamRandomStronglyConnectedGenerator(builder, 5000, 1, 2, 1, 1, false, nPlayers, true, probaPlayers, probaTargets, maximumTargets, generator);
+        const CompactGame game = builder.getGame();
+
+        REQUIRE(game.size() == 5000);
+        REQUIRE(algorithms::tarjanIterative(game.size(), game.getOffsets(), game.getSuccessors()).size() == 1);
+        for (unsigned int p = 0 ; p < nPlayers ; p++) {
+            bool hasTarget = false;
+            for (unsigned int v = 0 ; v < game.size() && !hasTarget ; v++) {
+                hasTarget = game.isTargetFor(v, p);
+            }
+            REQUIRE(hasTarget);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+#include "io/BinaryGame.hpp"
+#include "generators/StreamingGenerators.hpp"
+
+using namespace io;
+
+TEST_CASE("Format binaire", "[io]") {
+    const std::string path = "binaryGameTest.rgb";
+    const std::vector<double> probaPlayers = {0.2, 0.3, 0.5}, probaTargets = {0.1, 0.1, 0.1};
+    const std::vector<types::Long> maximumTargets(3, types::Long::infinity);
+
+    std::default_random_engine generator(3);
+    CompactGameBuilder builder;
+    generators::streamRandomGenerator(builder, 500, 1, 4, -3, 10, true, 3, true, probaPlayers, probaTargets, maximumTargets, generator);
+    const CompactGame original = builder.getGame();
+
+    SECTION("Écriture en flux puis chargement") {
+        std::default_random_engine again(3);
+        {
+            BinaryGameWriter writer(path);
+            generators::streamRandomGenerator(writer, 500, 1, 4, -3, 10, true, 3, true, probaPlayers, probaTargets, maximumTargets, again);
+        }
+        const CompactGame loaded = loadBinaryGame(path);
+
+        REQUIRE(loaded.size() == original.size());
+        REQUIRE(loaded.getNumberEdges() == original.getNumberEdges());
+        REQUIRE(loaded.getNumberPlayers() == 3);
+        REQUIRE(loaded.getInit() == original.getInit());
+        REQUIRE(std::equal(original.getOffsets(), original.getOffsets() + original.size() + 1, loaded.getOffsets()));
+        REQUIRE(std::equal(original.getSuccessors(), original.getSuccessors() + original.getNumberEdges(), loaded.getSuccessors()));
+        REQUIRE(std::equal(original.getWeights(), original.getWeights() + 3 * original.getNumberEdges(), loaded.getWeights()));
+        REQUIRE(std::equal(original.getOwners(), original.getOwners() + original.size(), loaded.getOwners()));
+        REQUIRE(std::equal(original.getTargets(), original.getTargets() + original.size(), loaded.getTargets()));
+    }
+
+    SECTION("Écriture d'un ReachabilityGame") {
+        writeBinaryGame(original.toReachabilityGame(), path);
+        const CompactGame loaded = loadBinaryGame(path);
+
+        REQUIRE(loaded.size() == original.size());
+        REQUIRE(loaded.getNumberEdges() == original.getNumberEdges());
+        for (unsigned int v = 0 ; v < loaded.size() ; v++) {
+            REQUIRE(loaded.getPlayer(v) == original.getPlayer(v));
+            REQUIRE(loaded.getNumberSuccessors(v) == original.getNumberSuccessors(v));
+            for (unsigned int p = 0 ; p < 3 ; p++) {
+                REQUIRE(loaded.isTargetFor(v, p) == original.isTargetFor(v, p));
+            }
+        }
+    }
+
+    SECTION("Le jeu reste valide après la destruction des autres copies") {
+        writeBinaryGame(original, path);
+        CompactGame copy = loadBinaryGame(path);
+        {
+            CompactGame loaded = loadBinaryGame(path);
+            copy = loaded;
+        }
+        REQUIRE(copy.getSuccessor(0) == original.getSuccessor(0));
+    }
+
+    SECTION("Erreurs") {
+        BinaryGameWriter writer(path);
+        const long weights[] = {1, 1, 1};
+        writer.begin(3, 3, 0);
+        writer.addEdge(1, 0, weights);
+        REQUIRE_THROWS_AS(writer.addEdge(0, 1, weights), std::runtime_error);
+
+        {
+            std::ofstream file(path);
+            file << "digraph G {}";
+        }
+        REQUIRE_THROWS_AS(loadBinaryGame(path), std::runtime_error);
+        REQUIRE_THROWS_AS(loadBinaryGame("fichierInexistant.rgb"), std::runtime_error);
+    }
+
+    SECTION("Fichier abîmé") {
+        // Un jeu valide de deux sommets, dont on abîme ensuite un tableau
+        auto writeSmall = [&]() {
+            BinaryGameWriter writer(path);
+            const long weights[] = {1};
+            writer.begin(2, 1, 0);
+            writer.addEdge(0, 1, weights);
+            writer.addEdge(1, 0, weights);
+            writer.finish();
+        };
+        auto corrupt = [&](std::uint64_t BinaryGameHeader::*position, std::size_t index, auto value) {
+            BinaryGameHeader header;
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            file.read(reinterpret_cast<char*>(&header), sizeof(header));
+            file.seekp(header.*position + index * sizeof(value));
+            file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+
+        writeSmall();
+        REQUIRE(loadBinaryGame(path).size() == 2);
+
+        corrupt(&BinaryGameHeader::successorsPosition, 1, std::uint32_t(700000000));
+        REQUIRE_THROWS_AS(loadBinaryGame(path), std::runtime_error);
+        // Sans vérification, le fichier est ouvert sans relire son contenu
+        REQUIRE(loadBinaryGame(path, false).getSuccessor(1) == 700000000);
+
+        writeSmall();
+        corrupt(&BinaryGameHeader::ownersPosition, 0, std::uint32_t(3));
+        REQUIRE_THROWS_AS(loadBinaryGame(path), std::runtime_error);
+
+        writeSmall();
+        corrupt(&BinaryGameHeader::offsetsPosition, 1, std::uint64_t(5));
+        REQUIRE_THROWS_AS(loadBinaryGame(path), std::runtime_error);
+    }
+
+    std::remove(path.c_str());
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "io/SolverDaemon.hpp"
+#include "io/BufferedWriter.hpp"
+#include "io/Results.hpp"
+
+using namespace io;
+
+/**
+ * \brief Un client minimal du serveur
+ */
+class DaemonClient {
+public:
+    explicit DaemonClient(const std::string &socketPath) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        socketPath.copy(address.sun_path, sizeof(address.sun_path) - 1);
+        m_socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        REQUIRE(::connect(m_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+    }
+
+    ~DaemonClient() {
+        ::close(m_socket);
+    }
+
+    std::string request(const std::string &text) {
+        REQUIRE(::write(m_socket, text.data(), text.size()) == ssize_t(text.size()));
+        std::string line;
+        char c;
+        while (::read(m_socket, &c, 1) == 1 && c != '\n') {
+            line += c;
+        }
+        return line;
+    }
+
+private:
+    int m_socket;
+};
+
+TEST_CASE("Serveur de résolution", "[io]") {
+    const std::string socketPath = "daemonTest.sock";
+    const std::string gameText =
+        "game 4 2 0\n"
+        "v 1 1\n"
+        "v 2 0 0\n"
+        "v 3 0 1\n"
+        "e 0 1 1\n"
+        "e 1 2 1\n"
+        "e 2 3 1\n"
+        "e 3 3 1\n";
+
+    SolverDaemon daemon(socketPath, 2);
+    std::thread server([&daemon]() { daemon.run(); });
+
+    {
+        DaemonClient client(socketPath);
+
+        SECTION("Jeu envoyé avec la requête") {
+            std::string response = client.request("game g edgelist " + std::to_string(gameText.size()) + "\n" + gameText);
+            REQUIRE(response == "{\"ok\":true,\"name\":\"g\",\"vertices\":4,\"edges\":4,\"players\":2}");
+
+            response = client.request("warm g\n");
+            REQUIRE(response.find("\"ok\":true") != std::string::npos);
+
+            // Deux résolutions : la seconde réutilise les valeurs de coalition et les coûts déjà calculés
+            for (int i = 0 ; i < 2 ; i++) {
+                response = client.request("solve g astar time=10\n");
+                REQUIRE(response.find("\"status\":\"ok\"") != std::string::npos);
+                REQUIRE(response.find("\"path\":[0,1,2,3") != std::string::npos);
+                REQUIRE(response.find("{\"reached\":true,\"cost\":2},{\"reached\":true,\"cost\":3}") != std::string::npos);
+            }
+
+            response = client.request("list\n");
+            REQUIRE(response == "{\"ok\":true,\"games\":[{\"name\":\"g\",\"vertices\":4,\"players\":2}]}");
+
+            response = client.request("unload g\n");
+            REQUIRE(response.find("\"ok\":true") != std::string::npos);
+            response = client.request("solve g astar\n");
+            REQUIRE(response.find("\"ok\":false") != std::string::npos);
+        }
+
+        SECTION("Jeu chargé depuis un fichier") {
+            const std::string path = "daemonTest.txt";
+            {
+                BufferedWriter writer(path);
+                writer.write(gameText);
+            }
+            std::string response = client.request("load g " + path + "\n");
+            REQUIRE(response.find("\"ok\":true") != std::string::npos);
+            response = client.request("solve g uniform\n");
+            REQUIRE(response.find("\"status\":\"ok\"") != std::string::npos);
+            std::remove(path.c_str());
+        }
+
+        SECTION("Requêtes invalides") {
+            REQUIRE(client.request("solve inconnu astar\n").find("\"ok\":false") != std::string::npos);
+            REQUIRE(client.request("frobnicate\n").find("\"ok\":false") != std::string::npos);
+            REQUIRE(client.request("game g xml 3\nabc").find("\"ok\":false") != std::string::npos);
+            REQUIRE(client.request("game g edgelist 3\nabc").find("\"ok\":false") != std::string::npos);
+            // La connexion reste utilisable après une erreur
+            REQUIRE(client.request("list\n") == "{\"ok\":true,\"games\":[]}");
+        }
+
+        REQUIRE(client.request("shutdown\n") == "{\"ok\":true}");
+    }
+    server.join();
+}
+TEST_CASE("Temps restant avant l'échéance", "[io]") {
+    const auto now = std::chrono::steady_clock::now();
+    const auto deadline = now + std::chrono::seconds(2);
+
+    REQUIRE(remainingSeconds(deadline, now) == 2);
+    // Une attente de moins d'une seconde est décomptée de l'échéance, mais les moteurs comptent en secondes entières
+    REQUIRE(remainingSeconds(deadline, now + std::chrono::milliseconds(300)) == 2);
+    REQUIRE(remainingSeconds(deadline, now + std::chrono::milliseconds(1500)) == 1);
+    REQUIRE(remainingSeconds(deadline, now + std::chrono::milliseconds(1999)) == 1);
+    REQUIRE(remainingSeconds(deadline, now + std::chrono::seconds(2)) == 0);
+    REQUIRE(remainingSeconds(deadline, now + std::chrono::milliseconds(2001)) == 0);
+}
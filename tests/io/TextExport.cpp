@@ -0,0 +1,92 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include <climits>
+#include <cstdio>
+#include <sstream>
+
+#include "io/TextExport.hpp"
+#include "io/TextGame.hpp"
+#include "generators/StreamingGenerators.hpp"
+
+using namespace io;
+
+bool sameGame(const CompactGame &a, const CompactGame &b) {
+    return a.size() == b.size()
+        && a.getNumberEdges() == b.getNumberEdges()
+        && a.getNumberPlayers() == b.getNumberPlayers()
+        && a.getInit() == b.getInit()
+        && std::equal(a.getOffsets(), a.getOffsets() + a.size() + 1, b.getOffsets())
+        && std::equal(a.getSuccessors(), a.getSuccessors() + a.getNumberEdges(), b.getSuccessors())
+        && std::equal(a.getWeights(), a.getWeights() + a.getNumberEdges() * a.getNumberPlayers(), b.getWeights())
+        && std::equal(a.getOwners(), a.getOwners() + a.size(), b.getOwners())
+        && std::equal(a.getTargets(), a.getTargets() + a.size() * CompactGame::targetWords(a.getNumberPlayers()), b.getTargets());
+}
+
+TEST_CASE("Écriture tamponnée", "[io]") {
+    std::ostringstream stream;
+    {
+        BufferedWriter writer(stream, 8);
+        writer << "a" << 0 << ' ' << -5L << ' ' << LONG_MIN << ' ' << LONG_MAX << ' ' << 42u;
+        writer.write(std::string("une chaîne plus longue que le tampon"));
+    }
+    std::ostringstream expected;
+    expected << "a0 -5 " << LONG_MIN << ' ' << LONG_MAX << " 42une chaîne plus longue que le tampon";
+    REQUIRE(stream.str() == expected.str());
+}
+
+TEST_CASE("Export DOT et liste d'arcs", "[io]") {
+    const std::string path = "exportTest.txt";
+    const std::vector<double> probaPlayers = {0.25, 0.25, 0.25, 0.25}, probaTargets = {0.2, 0.2, 0.2, 0.2};
+    const std::vector<types::Long> maximumTargets(4, types::Long::infinity);
+
+    std::default_random_engine generator(21);
+    CompactGameBuilder builder;
+    generators::streamRandomGenerator(builder, 300, 1, 5, -10, 10, true, 4, true, probaPlayers, probaTargets, maximumTargets, generator);
+    const CompactGame original = builder.getGame();
+
+    SECTION("DOT") {
+        {
+            BufferedWriter writer(path);
+            writeDOT(original, writer);
+        }
+        REQUIRE(sameGame(original, loadDOT(path)));
+    }
+
+    SECTION("Liste d'arcs") {
+        {
+            BufferedWriter writer(path);
+            writeEdgeList(original, writer);
+        }
+        REQUIRE(sameGame(original, loadEdgeList(path)));
+    }
+
+    SECTION("Liste d'arcs en flux") {
+        std::default_random_engine again(21);
+        {
+            BufferedWriter writer(path);
+            EdgeListWriter sink(writer);
+            generators::streamRandomGenerator(sink, 300, 1, 5, -10, 10, true, 4, true, probaPlayers, probaTargets, maximumTargets, again);
+        }
+        REQUIRE(sameGame(original, loadEdgeList(path)));
+    }
+
+    std::remove(path.c_str());
+}
\ No newline at end of file
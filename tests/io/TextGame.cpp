@@ -0,0 +1,174 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "io/TextGame.hpp"
+
+using namespace io;
+
+void writeTextFile(const std::string &path, const std::string &content) {
+    std::ofstream file(path);
+    file << content;
+}
+
+TEST_CASE("Lecture d'une liste d'arcs", "[io]") {
+    const std::string path = "edgeListTest.txt";
+
+    SECTION("Jeu valide") {
+        writeTextFile(path,
+            "# Un jeu à trois joueurs\n"
+            "game 4 3 2\n"
+            "v 0 1 2\n"
+            "v 1 2 0 1   # cible pour 0 et 1\n"
+            "\n"
+            "e 0 1 4 5 6\n"
+            "e 2 3 -7\n"
+            "e 1 0 1 2 3\n"
+            "e 3 3 1\n");
+        const CompactGame game = loadEdgeList(path);
+
+        REQUIRE(game.size() == 4);
+        REQUIRE(game.getNumberPlayers() == 3);
+        REQUIRE(game.getInit() == 2);
+        REQUIRE(game.getPlayer(0) == 1);
+        REQUIRE(game.getPlayer(1) == 2);
+        REQUIRE(game.getPlayer(2) == 0);
+        REQUIRE(game.isTargetFor(0, 2));
+        REQUIRE(game.isTargetFor(1, 0));
+        REQUIRE(game.isTargetFor(1, 1));
+        REQUIRE_FALSE(game.isTarget(2));
+        REQUIRE(game.getNumberEdges() == 4);
+        REQUIRE(game.getSuccessor(game.beginEdges(0)) == 1);
+        REQUIRE(game.getWeights(game.beginEdges(0))[2] == 6);
+        REQUIRE(game.getWeights(game.beginEdges(2))[1] == -7);
+        REQUIRE(game.getSuccessor(game.beginEdges(1)) == 0);
+
+        // loadTextGame reconnaît le format
+        REQUIRE(loadTextGame(path).getNumberEdges() == 4);
+    }
+
+    SECTION("Erreurs") {
+        writeTextFile(path, "v 0 0\ngame 2 2 0\n");
+        REQUIRE_THROWS_AS(loadEdgeList(path), std::runtime_error);
+        writeTextFile(path, "game 2 2 0\ne 0 2 1\n");
+        REQUIRE_THROWS_AS(loadEdgeList(path), std::runtime_error);
+        writeTextFile(path, "game 2 2 0\ne 0 1 1 2 3\n");
+        REQUIRE_THROWS_AS(loadEdgeList(path), std::runtime_error);
+        writeTextFile(path, "game 2 2 0\nx 0 1\n");
+        REQUIRE_THROWS_AS(loadEdgeList(path), std::runtime_error);
+        writeTextFile(path, "game 2 2 0\nv 0 2\n");
+        REQUIRE_THROWS_AS(loadEdgeList(path), std::runtime_error);
+        // Les cibles 2 et 3 n'ont aucun successeur
+        writeTextFile(path, "game 4 2 0\nv 2 0 0\nv 3 0 1\ne 0 1 1\ne 1 0 1\ne 1 3 1\ne 0 2 1\n");
+        REQUIRE_THROWS_AS(loadEdgeList(path), std::runtime_error);
+        writeTextFile(path, "game 4 2 0\nv 2 0 0\nv 3 0 1\ne 0 1 1\ne 1 0 1\ne 1 3 1\ne 0 2 1\ne 2 2 0\ne 3 3 0\n");
+        REQUIRE(loadEdgeList(path).getNumberEdges() == 6);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Lecture d'un fichier DOT", "[io]") {
+    const std::string path = "dotTest.dot";
+
+    SECTION("Sortie de printDOT") {
+        Vertex::Ptr v0 = std::make_shared<Vertex>(0, 0, 2);
+        Vertex::Ptr v1 = std::make_shared<Vertex>(1, 1, 2);
+        Vertex::Ptr v2 = std::make_shared<Vertex>(2, 0, 2);
+        v0->addSuccessor(v1, {1, 2});
+        v1->addSuccessor(v2, {3, 4});
+        v2->addSuccessor(v0, {5, 6});
+        v2->addSuccessor(v2, {7, 8});
+        v1->addTargetFor(0);
+        v2->addTargetFor(1);
+        Graph g({v0, v1, v2}, 2);
+        Player p1(0, {v0, v2}, {v1});
+        Player p2(1, {v1}, {v2});
+        ReachabilityGame original(g, v0, {p1, p2});
+
+        std::ostringstream dot;
+        std::streambuf* previous = std::cout.rdbuf(dot.rdbuf());
+        original.printDOT();
+        std::cout.rdbuf(previous);
+        writeTextFile(path, dot.str());
+
+        const CompactGame game = loadTextGame(path);
+        REQUIRE(game.size() == 3);
+        REQUIRE(game.getNumberPlayers() == 2);
+        REQUIRE(game.getInit() == 0);
+        REQUIRE(game.getPlayer(0) == 0);
+        REQUIRE(game.getPlayer(1) == 1);
+        REQUIRE(game.isTargetFor(1, 0));
+        REQUIRE(game.isTargetFor(2, 1));
+        REQUIRE_FALSE(game.isTarget(0));
+        REQUIRE(game.getNumberEdges() == 4);
+        REQUIRE(game.getNumberSuccessors(2) == 2);
+        REQUIRE(game.getSuccessor(game.beginEdges(1)) == 2);
+        REQUIRE(game.getWeights(game.beginEdges(1))[1] == 4);
+    }
+
+    SECTION("Attributs explicites et noms quelconques") {
+        writeTextFile(path,
+            "/* Trois joueurs */\n"
+            "strict digraph jeu {\n"
+            "  players = 3;\n"
+            "  node [shape=circle];\n"
+            "  depart [player=2, init=true];\n"
+            "  \"milieu\" [player=1, targets=\"0,2\"]\n"
+            "  fin [targets=\"1\"]; // commentaire\n"
+            "  depart -> milieu -> fin [weights=\"1,-2,3\"];\n"
+            "  fin -> fin [label=\"9\"]\n"
+            "}\n");
+        const CompactGame game = loadDOT(path);
+
+        REQUIRE(game.size() == 3);
+        REQUIRE(game.getNumberPlayers() == 3);
+        REQUIRE(game.getInit() == 0);
+        REQUIRE(game.getPlayer(0) == 2);
+        REQUIRE(game.getPlayer(1) == 1);
+        REQUIRE(game.isTargetFor(1, 0));
+        REQUIRE(game.isTargetFor(1, 2));
+        REQUIRE(game.isTargetFor(2, 1));
+        REQUIRE(game.getNumberEdges() == 3);
+        REQUIRE(game.getWeights(game.beginEdges(1))[1] == -2);
+        REQUIRE(game.getWeights(game.beginEdges(2))[2] == 9);
+    }
+
+    SECTION("Erreurs") {
+        writeTextFile(path, "graph G { a -- b }");
+        REQUIRE_THROWS_AS(loadDOT(path), std::runtime_error);
+        writeTextFile(path, "digraph G { a -> b [weights=\"1,2\"]; b -> a [weights=\"1,2,3\"] }");
+        REQUIRE_THROWS_AS(loadDOT(path), std::runtime_error);
+        writeTextFile(path, "digraph G { a -> b ");
+        REQUIRE_THROWS_AS(loadDOT(path), std::runtime_error);
+        // b n'a aucun successeur
+        writeTextFile(path, "digraph G { a -> b; a -> a }");
+        REQUIRE_THROWS_AS(loadDOT(path), std::runtime_error);
+        // Le sommet d'ID 1 n'est pas déclaré
+        writeTextFile(path, "digraph G { v0 -> v2; v2 -> v0 }");
+        REQUIRE_THROWS_AS(loadDOT(path), std::runtime_error);
+    }
+
+    std::remove(path.c_str());
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include "types/AliasTable.hpp"
+
+using namespace types;
+
+TEST_CASE("Table d'alias", "[types]") {
+    std::default_random_engine generator(5);
+
+    SECTION("Les fréquences suivent les poids") {
+        const std::vector<double> weights = {1, 0, 3, 6};
+        std::vector<float> probabilities(weights.size());
+        std::vector<unsigned int> aliases(weights.size());
+        aliasTable::build(weights.data(), weights.size(), probabilities.data(), aliases.data());
+
+        std::vector<std::size_t> counts(weights.size(), 0);
+        const std::size_t n = 100000;
+        for (std::size_t i = 0 ; i < n ; i++) {
+            counts[aliasTable::draw(probabilities.data(), aliases.data(), weights.size(), generator)]++;
+        }
+        REQUIRE(counts[1] == 0);
+        REQUIRE(counts[0] == Approx(0.1 * n).epsilon(0.05));
+        REQUIRE(counts[2] == Approx(0.3 * n).epsilon(0.05));
+        REQUIRE(counts[3] == Approx(0.6 * n).epsilon(0.05));
+    }
+
+    SECTION("Une seule entrée") {
+        const double weight = 2;
+        float probability;
+        unsigned int alias;
+        aliasTable::build(&weight, 1, &probability, &alias);
+        REQUIRE(aliasTable::draw(&probability, &alias, 1, generator) == 0);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+ * ReachabilityGame - a program to compute the best Nash equilibrium in reachability games
+ * Copyright (C) 2018 Gaëtan Staquet and Aline Goeminne
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "catch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "types/ThreadPool.hpp"
+
+using namespace types;
+
+TEST_CASE("Ensemble de threads", "[types]") {
+    ThreadPool pool(4);
+
+    SECTION("Chaque indice est traité une fois") {
+        std::vector<std::atomic<int>> counts(1000);
+        parallelFor(pool, counts.size(), [&](std::size_t i, std::size_t) {
+            counts[i]++;
+        });
+        for (const std::atomic<int> &count : counts) {
+            REQUIRE(count == 1);
+        }
+    }
+
+    SECTION("Une exception est relancée quand toutes les tâches sont finies") {
+        std::atomic<int> running(0);
+        std::atomic<std::size_t> processed(0);
+        REQUIRE_THROWS_AS(parallelFor(pool, 200, [&](std::size_t i, std::size_t) {
+            running++;
+            if (i == 3) {
+                running--;
+                throw std::runtime_error("indice 3");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            processed++;
+            running--;
+        }), std::runtime_error);
+        // Plus aucune tâche n'utilise la fonction après le retour
+        REQUIRE(running == 0);
+        REQUIRE(processed < 199);
+
+        // L'ensemble reste utilisable
+        std::atomic<std::size_t> total(0);
+        parallelFor(pool, 10, [&](std::size_t, std::size_t) {
+            total++;
+        });
+        REQUIRE(total == 10);
+    }
+}